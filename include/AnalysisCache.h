@@ -0,0 +1,35 @@
+#ifndef YAC8_INTERPRETER_ANALYSISCACHE_H
+#define YAC8_INTERPRETER_ANALYSISCACHE_H
+
+#include <stdint.h>
+#include <string>
+
+#include "Disassembler.h"
+
+#define ANALYSIS_CACHE_VERSION 4  // Bumped whenever the File Layout or Analysis Changes
+
+/**
+ * On-Disk Cache of ROM Analysis Results
+ *  - One File per ROM in the Cache Directory, Named by the
+ *      Hash of the ROM's Bytes so Renamed/Moved ROMs still Hit
+ *  - Files are Memory Mapped and Validated before use, anything
+ *      Stale or Corrupt is a Miss
+ */
+class AnalysisCache {
+  private:
+    std::string dir;                            // Cache Directory
+
+    std::string entryPath(uint64_t romHash) const;
+
+  public:
+    AnalysisCache(const std::string &dir);
+    static std::string defaultDir();            // $XDG_CACHE_HOME/yac8 or ~/.cache/yac8
+
+    bool load(uint64_t romHash, ProgramMap &map) const;         // True on Cache Hit
+    bool store(uint64_t romHash, const ProgramMap &map) const;  // True if Written
+
+    ProgramMap analyze(const u_char *rom, u_int16_t size);      // Cached Disassembler::analyze
+};
+
+
+#endif  //YAC8_INTERPRETER_ANALYSISCACHE_H
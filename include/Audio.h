@@ -0,0 +1,65 @@
+#ifndef YAC8_INTERPRETER_AUDIO_H
+#define YAC8_INTERPRETER_AUDIO_H
+
+#define AUDIO_SAMPLE_RATE 48000  // Output Samples per Second
+#define AUDIO_BUFFER_SIZE 256    // Samples per Callback (~5.3ms at 48kHz)
+#define AUDIO_TONE 440           // Buzzer Frequency (Hz)
+#define AUDIO_VOLUME 0x1000      // Buzzer Amplitude (of 0x7FFF)
+#define AUDIO_TABLE_SIZE 256     // Samples in one Period of the Waveform Table
+#define AUDIO_FRAME_RATE 60      // Emulated Frames per Second when Clocking Emulation
+#define AUDIO_PATTERN_RATE 4000  // XO-CHIP Pattern Samples per Second at Pitch 64
+
+#include <SDL2/SDL.h>
+
+#include <atomic>
+
+// Runs one Emulated Frame, called from the Audio Thread
+typedef void (*AudioFrameCallback)(void *userdata);
+
+/**
+ * Buzzer Output for the Sound Timer
+ *  - CPU Thread Publishes the Sound Timer with a single
+ *      Relaxed Store, no Locks or Allocation
+ *  - SDL's Audio Thread Plays a Precomputed Waveform
+ *      while the Last Published Value is Non-Zero
+ *  - XO-CHIP ROMs Replace the Waveform with their own
+ *      128 Sample 1-bit Pattern, Played at their Pitch
+ *  - Optionally the Device is the Master Clock, running a
+ *      Frame every 1/60s worth of Samples it Consumes
+ */
+class Audio {
+  private:
+    SDL_AudioDeviceID device;                // Opened Device (0 if None)
+    int frequency;                           // Device's Sample Rate
+    AudioFrameCallback onFrame;              // Frame Clocked by the Device (NULL if None)
+    void *frameUserdata;                     // Passed to onFrame
+    int frameClock;                          // Samples since the last Frame, times AUDIO_FRAME_RATE
+    std::atomic<u_char> soundTimer;          // Last Published Sound Timer
+    int16_t waveTable[AUDIO_TABLE_SIZE];     // One Period of the Buzzer
+    u_int32_t phase, phaseStep;              // Table Position, Fixed Point (Top 8 Bits Index)
+    int32_t gain;                            // Ramps toward Full/Silent to avoid Clicks
+    std::atomic<uint64_t> patternHigh, patternLow;  // Published XO-CHIP Pattern, Bit 63 of High Plays First
+    std::atomic<u_int32_t> patternStep;      // Pattern Phase per Sample (0 Plays the Waveform)
+    u_int32_t patternPhase;                  // Pattern Position, Fixed Point (Top 7 Bits Index)
+
+    static void callback(void *userdata, Uint8 *stream, int len);  // SDL Audio Thread
+
+  public:
+    Audio();
+    ~Audio();
+
+    void setFrameCallback(AudioFrameCallback, void *);  // Clocks Frames off the Device, Set before open
+    bool open();                             // Opens the Default Device, False if Unavailable
+    void close();                            // Closes the Device
+
+    /**
+     * Publishes the Sound Timer, Buzzer Plays while Non-Zero
+     *  Safe to call from the CPU Thread every Frame
+     */
+    void setSoundTimer(u_char value) { soundTimer.store(value, std::memory_order_relaxed); }
+
+    void setPattern(const u_char pattern[16], u_char pitch);  // Plays an XO-CHIP Pattern instead (F002/FX3A)
+};
+
+
+#endif  //YAC8_INTERPRETER_AUDIO_H
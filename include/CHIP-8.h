@@ -1,10 +1,12 @@
 #pragma once
-#include "Disassembler.h"
+#include "types.h"
+#include <cstddef>
 #include <cstring>
-#include <sstream>
-#include <stack>
+#include <iosfwd>
+#include <stdint.h>
 #include <stdlib.h>
 #include <time.h>
+#include <vector>
 
 #define CHIP8_DEBUG 0
 
@@ -12,7 +14,7 @@
 
 /**
  * MEMORY:
- *  - 4KB Total Memory (0x000 - 0xFFF)
+ *  - 4KB Total Memory (0x000 - 0xFFF), 64KB in XO-CHIP Mode (0x0000 - 0xFFFF)
  *      - 512  Bytes (0x000 - 0x1FF) = CHIP-8 Interpreter (ROM)
  *          - Commonly Stored outside of Memory so, can be used
  *              for Front Data Storage
@@ -49,6 +51,44 @@ const u_char fontSet[0x50] = {
     0xF0, 0x80, 0xF0, 0x80, 0x80   // F
 };
 
+// SUPER-CHIP 8x10 Fonts (0-F) Stored right after the Small Font
+#define BIG_FONT_START 0x50
+const u_char bigFontSet[0xA0] = {
+    0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,  // 0
+    0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C,  // 1
+    0x3E, 0x7F, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF,  // 2
+    0x3C, 0x7E, 0xC3, 0x03, 0x0E, 0x0E, 0x03, 0xC3, 0x7E, 0x3C,  // 3
+    0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06,  // 4
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x03, 0xC3, 0x7E, 0x3C,  // 5
+    0x3E, 0x7C, 0xC0, 0xC0, 0xFC, 0xFE, 0xC3, 0xC3, 0x7E, 0x3C,  // 6
+    0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60,  // 7
+    0x3C, 0x7E, 0xC3, 0xC3, 0x7E, 0x7E, 0xC3, 0xC3, 0x7E, 0x3C,  // 8
+    0x3C, 0x7E, 0xC3, 0xC3, 0x7F, 0x3F, 0x03, 0x03, 0x3E, 0x7C,  // 9
+    0x3C, 0x7E, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3,  // A
+    0xFC, 0xFE, 0xC3, 0xC3, 0xFE, 0xFE, 0xC3, 0xC3, 0xFE, 0xFC,  // B
+    0x3C, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0x3C,  // C
+    0xFC, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xFC,  // D
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF,  // E
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0   // F
+};
+
+// Display Resolutions, 64x32 (CHIP-8) and 128x64 (SUPER-CHIP Hires)
+#define DISPLAY_WIDTH 64
+#define DISPLAY_HEIGHT 32
+#define DISPLAY_HIRES_WIDTH 128
+#define DISPLAY_HIRES_HEIGHT 64
+#define DISPLAY_PLANES 2  // XO-CHIP Bitplanes, CHIP-8 and SUPER-CHIP only Draw on Plane 1
+
+// Memory Sizes, XO-CHIP's is only Allocated in XO-CHIP Mode
+#define MEMORY_SIZE 0x1000
+#define XO_MEMORY_SIZE 0x10000
+
+// Machine the Core Runs as, Picked before a ROM is Loaded (CHIP8::setMode)
+enum Mode : u_char {
+    MODE_CHIP8 = 0,    // CHIP-8 and SUPER-CHIP, 4KB Memory
+    MODE_XO_CHIP       // XO-CHIP, 64KB Memory
+};
+
 // Used for Pixel Change Identificaiton
 //  (x,y) Positions for Pixel
 struct Pixel {
@@ -57,30 +97,254 @@ struct Pixel {
     u_char val;
 };
 
+// Operations an Instruction Decodes to (Instruction::op)
+enum Operation : u_char {
+    OP_UNDECODED = 0,  // Empty Decode Cache Entry
+    OP_NOP,            // 0NNN & Unknown Opcodes
+    OP_CLS,            // 00E0
+    OP_RET,            // 00EE
+    OP_JP,             // 1NNN
+    OP_CALL,           // 2NNN
+    OP_SE_BYTE,        // 3XKK
+    OP_SNE_BYTE,       // 4XKK
+    OP_SE_REG,         // 5XY0
+    OP_LD_BYTE,        // 6XKK
+    OP_ADD_BYTE,       // 7XKK
+    OP_LD_REG,         // 8XY0
+    OP_OR,             // 8XY1
+    OP_AND,            // 8XY2
+    OP_XOR,            // 8XY3
+    OP_ADD_REG,        // 8XY4
+    OP_SUB,            // 8XY5
+    OP_SHR,            // 8XY6
+    OP_SUBN,           // 8XY7
+    OP_SHL,            // 8XYE
+    OP_SNE_REG,        // 9XY0
+    OP_LD_I,           // ANNN
+    OP_JP_V0,          // BNNN
+    OP_RND,            // CXKK
+    OP_DRW,            // DXYN
+    OP_SKP,            // EX9E
+    OP_SKNP,           // EXA1
+    OP_LD_VX_DT,       // FX07
+    OP_LD_VX_K,        // FX0A
+    OP_LD_DT,          // FX15
+    OP_LD_ST,          // FX18
+    OP_ADD_I,          // FX1E
+    OP_LD_F,           // FX29
+    OP_LD_B,           // FX33
+    OP_LD_MEM_VX,      // FX55
+    OP_LD_VX_MEM,      // FX65
+
+    // SUPER-CHIP
+    OP_SCD,            // 00CN
+    OP_SCR,            // 00FB
+    OP_SCL,            // 00FC
+    OP_EXIT,           // 00FD
+    OP_LOW,            // 00FE
+    OP_HIGH,           // 00FF
+    OP_LD_HF,          // FX30
+    OP_LD_R_VX,        // FX75
+    OP_LD_VX_R,        // FX85
+
+    // XO-CHIP
+    OP_SCU,            // 00DN
+    OP_LD_MEM_RANGE,   // 5XY2
+    OP_LD_RANGE_MEM,   // 5XY3
+    OP_LD_I_LONG,      // F000 NNNN
+    OP_PLANE,          // FN01
+    OP_LD_PATTERN,     // F002
+    OP_LD_PITCH,       // FX3A
+
+    // Flag Dead Variants, only in the Decode Cache (Next
+    //  Instruction Overwrites VF before Reading it)
+    OP_ADD_REG_NF,     // 8XY4
+    OP_SUB_NF,         // 8XY5
+    OP_SHR_NF,         // 8XY6
+    OP_SUBN_NF,        // 8XY7
+    OP_SHL_NF,         // 8XYE
+
+    // Fused Pairs, only in the Decode Cache (x, y, n hold both
+    //  Opcodes' Low 12 Bits, see CHIP8::fuse)
+    OP_SE_JP,          // 3XKK 1NNN
+    OP_SNE_JP,         // 4XKK 1NNN
+    OP_LD_LD,          // 6XKK 6XKK
+    OP_LD_SKNP,        // 6XKK EXA1
+    OP_ADD_SE,         // 7XKK 3XKK
+    OP_LD_I_ADD_I,     // ANNN FX1E
+    OP_LD_I_DRW        // ANNN DXYN
+};
+
+// Mnemonic Names of each Unfused Operation (Indexed by Operation)
+const char *const operationNames[] = {
+    "UNDECODED", "NOP", "CLS", "RET", "JP", "CALL", "SE_BYTE", "SNE_BYTE",
+    "SE_REG", "LD_BYTE", "ADD_BYTE", "LD_REG", "OR", "AND", "XOR", "ADD_REG",
+    "SUB", "SHR", "SUBN", "SHL", "SNE_REG", "LD_I", "JP_V0", "RND",
+    "DRW", "SKP", "SKNP", "LD_VX_DT", "LD_VX_K", "LD_DT", "LD_ST", "ADD_I",
+    "LD_F", "LD_B", "LD_MEM_VX", "LD_VX_MEM", "SCD", "SCR", "SCL", "EXIT",
+    "LOW", "HIGH", "LD_HF", "LD_R_VX", "LD_VX_R", "SCU", "LD_MEM_RANGE", "LD_RANGE_MEM",
+    "LD_I_LONG", "PLANE", "LD_PATTERN", "LD_PITCH"
+};
+#define OPERATION_COUNT (sizeof(operationNames) / sizeof(operationNames[0]))
+
+// Opcode Split into it's Operation and Nibbles
+//  KK = (y << 4) | n, NNN = (x << 8) | KK
+struct Instruction {
+    u_char op;  // Operation
+    u_char x;   // -X-- Nibble
+    u_char y;   // --Y- Nibble
+    u_char n;   // ---N Nibble
+};
+
+// Faults that Halt the CPU (CHIP8State::fault)
+enum Fault : u_char {
+    FAULT_NONE = 0,
+    FAULT_STACK_OVERFLOW,   // CALL with all 16 Stack Entries in use
+    FAULT_STACK_UNDERFLOW,  // RET with an Empty Stack
+    FAULT_EXIT              // 00FD, ROM Exited the Interpreter
+};
+
+/**
+ * Entire Machine State in one Trivially Copyable Block
+ *  so it can be memcpy'd, Hashed, and Snapshotted
+ *  - Cache Line 0: Hot Registers, the Stack, and the RNG
+ *  - Cache Line 1: SUPER-CHIP Mode, Flag Registers, and XO-CHIP Planes/Audio
+ *  - Cache Line 2-33: Packed Display (1-bit per Pixel per Plane)
+ *  - Remaining: Memory (Unused in XO-CHIP Mode, see CHIP8::memory)
+ */
+struct alignas(64) CHIP8State {
+    u_int16_t PC;              // Program counter
+    u_int16_t I;               // Index Register (Memory Addresses)
+    u_char SP;                 // Stack Pointer (Number of Return Addresses on the Stack)
+    u_char dTimer;             // Delay Timer 60Hz (Count down from 60 to 0)
+    u_char sTimer;             // Sound timer 60Hz (Count down from 60 to 0)
+    u_char fault;              // Fault that Halted the CPU (FAULT_NONE if Running)
+    u_char V[16];              // 16 8-bit Registers (V0 - VF)
+    u_int16_t stack[16];       // Store return addresses when subroutines are called
+    uint64_t rng;              // Random Generator State for CXKK (xorshift64*, Never 0)
+
+    u_char hires;              // SUPER-CHIP 128x64 Mode (00FF), 64x32 if 0 (00FE)
+    u_char rpl[16];            // SUPER-CHIP Flag Registers (FX75/FX85)
+    u_char planes;             // XO-CHIP Planes Drawn, Cleared, and Scrolled (FN01), Bit 0 = Plane 1
+    u_char pitch;              // XO-CHIP Audio Pattern Pitch (FX3A), 64 = 4000 Samples per Second
+    u_char pattern[16];        // XO-CHIP Audio Pattern, 128 1-bit Samples (F002)
+    u_char reserved[29];       // Pads the Mode Line, Always 0 so Hashes are Stable
+
+    // Bitplanes of 128 Bits per Row: Word 0 is x = 0-63, Word 1 is x = 64-127,
+    //  Bit 63 of a Word is it's Leftmost x. 64x32 only uses Word 0 of Rows 0-31.
+    //  A Pixel's Color is Palette[Plane 1 Bit | Plane 2 Bit << 1]
+    alignas(64) uint64_t display[DISPLAY_PLANES][DISPLAY_HIRES_HEIGHT][2];
+    u_char memory[MEMORY_SIZE]; // 4K Bytes (0x000 - 0xFFF)
+};
+
+struct ProgramMap;  // Control Flow Analysis (Disassembler.h)
+struct CoreClone;   // Copy-on-Write Copy of a Core's State (CloneArena.h)
+class CloneArena;
+
+/**
+ * Expands the Packed Bitplanes into 32-bit Pixels through a 4 Color
+ *  Palette, one Row of Width Pixels after another. Branch Free
+ *  per Pixel so the Compiler Vectorizes it
+ *
+ * @param display - CHIP8State::display
+ * @param hires - 128x64 if True, 64x32 Otherwise
+ * @param palette - Colors Indexed by Plane 1 Bit | Plane 2 Bit << 1
+ * @param pixels - Output, 128x64 or 64x32 Pixels
+ */
+void compositeDisplay(const uint64_t display[DISPLAY_PLANES][DISPLAY_HIRES_HEIGHT][2], bool hires,
+                      const u_int32_t palette[4], u_int32_t *pixels);
+
+#define DIRTY_PAGE_SIZE 64  // Bytes of Memory per Dirty Page Bit (4096 / 64 Pages, Decode Cached Memory Only)
+
+class CHIP8;
+
+/**
+ * Late Input Latching, Asked for the Keys Held Right Now each
+ *  time EX9E, EXA1, or FX0A Runs (CHIP8::setKeyProvider)
+ * @returns Key Mask, Bit N = Key 0xN Pressed
+ */
+typedef u_int16_t (*KeyProvider)(void *userdata);
+
+/**
+ * Told the Keys each EX9E, EXA1, or FX0A Sees as it Runs,
+ *  whether they were Latched or Set (CHIP8::setKeyObserver)
+ * @param mask - Keys Read, Bit N = Key 0xN Pressed
+ */
+typedef void (*KeyObserver)(u_int16_t mask, void *userdata);
+
+/**
+ * Entry Point of a ROM Translated Ahead of Time (yac8_recompile)
+ *  Runs Translated Blocks starting at State's PC, returning once
+ *  it reaches an Untranslated Address, a Block that doesn't fit in
+ *  the Remaining count, or a Block whose Memory Page is Dirty
+ * @returns Number of Instructions Run
+ */
+typedef u_int32_t (*CompiledRun)(CHIP8 &cpu, CHIP8State &s, u_int32_t count, const uint64_t *dirtyPages);
+
+// ROM Translated Ahead of Time, Only Attaches to the ROM it was Translated from
+struct CompiledROM {
+    uint64_t romHash;   // Hash::hash64 of the ROM's Bytes
+    u_int16_t romSize;  // Size of the ROM in Bytes
+    CompiledRun run;    // Translated Code
+};
+
 class CHIP8 {
-  private:                        // Private Variables
-    u_char memory[4096];          // 4K Bytes (0x000 - 0xFFF)
-    u_char V[16];                 // 16 8-bit Registers (V0 - VF)
-    u_int16_t I;                  // Index Register (Memory Addresses)
-    u_int16_t PC = 0x200;         // Program counter
-    std::stack<u_int16_t> stack;  // Store return addresses when subroutines are called
-    u_char dTimer;                // Delay Timer 60Hz (Count down from 60 to 0)
-    u_char sTimer;                // Sound timer 60Hz (Count down from 60 to 0)
-    std::ostream *out;            // Output Stream for Outputting Execution Instruciton Information
-
-  private:        // Private Methods
-    void init();  // Initiates CHIP8 Data
+  private:                          // Private Variables
+    CHIP8State state;               // Machine State
+    CHIP8State bootImage;           // Machine State right after the ROM was Loaded
+    Mode mode;                      // Machine Running (setMode)
+    u_char *memory;                 // Active Memory, state.memory or xoMemory in XO-CHIP Mode
+    u_int16_t memoryMask;           // Active Memory's Address Mask (Addresses Wrap)
+    std::vector<u_char> xoMemory;   // XO-CHIP's 64KB Memory (Empty in CHIP-8 Mode)
+    std::vector<u_char> xoBootMemory;  // xoMemory right after the ROM was Loaded
+    std::ostream *out;              // Output Stream for Outputting Execution Instruciton Information
+    Instruction decodeCache[MEMORY_SIZE];  // Decoded Instruction per Address (XO-CHIP's Upper Memory is Uncached)
+    uint64_t dirtyPages;            // Memory Pages Written since Boot (Bit N = Page N)
+    const CompiledROM *compiled;    // Attached Ahead of Time Translation (NULL if None)
+    KeyProvider keyProvider;        // Latches key at each Key Read (NULL Reads key as Set)
+    void *keyUserdata;              // Passed to the Key Provider
+    uint64_t keyReadTime;           // steady_clock Nanoseconds of the Last Latch (0 if None)
+    KeyObserver keyObserver;        // Told the Keys at each Key Read (NULL if None)
+    void *observerUserdata;         // Passed to the Key Observer
+
+  private:                                 // Private Methods
+    void init();                           // Initiates CHIP8 Data
+    void invalidate(u_int16_t addr);       // Drops Decoded Instructions covering Address
+    Instruction decodeAt(u_int16_t addr);  // Decodes the Instruction at Address, Fused with the Next if Possible
+    static Instruction fuse(u_int16_t, u_int16_t);  // Fuses 2 Sequential Opcodes (OP_UNDECODED if they don't Fuse)
+    static bool overwritesVF(const Instruction &);  // True if the Instruction Writes VF without Reading it
+    static u_int32_t sharePage(CloneArena &, u_int32_t, const u_char *);  // Block Holding a Cloned Page, Shared if Unchanged
+    void interpret(u_int32_t count);       // Runs N Instructions through the Decode Cache
+    u_int16_t DRW64(uint64_t (*)[2], u_char, u_char, u_char, u_int16_t);   // DXYN on a Lores Plane, Returns Next Sprite Address
+    u_int16_t DRW128(uint64_t (*)[2], u_char, u_char, u_char, u_int16_t);  // DXYN on a Hires Plane (DXY0 is 16x16)
+    void skip();                           // Skips the Next Instruction (F000 NNNN is 4 Bytes)
+    void latchKeys();                      // Refreshes key from the Key Provider, then Tells the Key Observer
 
   public:                    // Public Variables
-    u_char display[64][32];  // Graphics are Monochrome 64x32 Pixels
     u_char key[16];          // 16 Key Hex Keyboard (Key ranges from 0-F) | Set as True(0x1) or False(0x0)
     bool drawFlag;           // Flag that Indicates a Draw Occured (Clear Counts)
+    bool soundFlag;          // Flag that Indicates the Sound Timer was Set Non-Zero (FX18) since Cleared
 
   public:                                 // Public Methods
     CHIP8();                              // Constructs CHIP8
     CHIP8(std::ostream *);                // Constructs CHIP8 with Output Stream
+    CHIP8(const CHIP8 &);                 // Copies the Machine (Memory Pointer Follows the Copy)
+    CHIP8 &operator=(const CHIP8 &);
+    void setMode(Mode);                   // Picks CHIP-8 or XO-CHIP, Clears the Machine (Load ROM after)
+    Mode getMode() const;                 // Returns the Machine Running
     void loadROM(char *romFile);          // Loads ROM Data into RAM
+    bool loadROM(const u_char *, size_t); // Loads ROM Data from a Buffer into RAM
+    void reset();                         // Restores the State the ROM was Loaded with
+    void seed(uint64_t);                  // Seeds the Random Generator (Kept across reset)
     void run(bool);                       // Runs Interpreter Sequentially or Infinitely
+    void step(u_int32_t);                 // Runs N Instructions through the Decode Cache (No Output)
+    bool runFrame(u_int32_t);             // Runs a Frame of N Instructions, True if Display Changed
+    void prewarm(const ProgramMap &);     // Decodes all Code found by Analysis ahead of Time
+    bool attach(const CompiledROM *);     // Runs the Loaded ROM's Translation in step, NULL Detaches
+    void setKeyProvider(KeyProvider, void *);  // Reads Keys only when an Instruction needs them, NULL Stops
+    void setKeyObserver(KeyObserver, void *);  // Tells Keys Read as Instructions Read them, NULL Stops
+    uint64_t getKeyReadTime() const;      // steady_clock Nanoseconds the Keys were Last Latched (0 if Never)
+    static Instruction decode(u_int16_t, Mode = MODE_CHIP8);  // Decodes Opcode into an Instruction (XO-CHIP Opcodes are NOPs in CHIP-8 Mode)
     void setOutputStream(std::ostream *); // Sets the Output Stream of the Instructions
     void memDump(std::ostream &);         // Returns a Memory Dump
     void regDump(std::ostream &);         // Outputs Register Dump to Output Stream
@@ -90,10 +354,25 @@ class CHIP8 {
 
     u_char getRegisterVal(u_char) const;  // Returns Register's Value at given Index
     u_char getMemVal(u_int16_t) const;    // Returns Value at Memory Address
+    size_t getMemSize() const;            // Returns the Active Memory's Size in Bytes
+    const u_char *getMemory() const;      // Returns the Active Memory (getMemSize Bytes)
     u_char get_dTimer() const;            // Returns the Delay Timer Value
     u_char get_sTimer() const;            // Returns the Sound Timer Value
+    bool isSoundOn() const;               // True if the Sound Timer is Running or was Set since soundFlag was Cleared
     u_int16_t getIndexReg() const;        // Returns the Index Register Value
     u_int16_t getProgramCounter() const;  // Returns the Program Counter Value
+    u_char getPixel(u_char, u_char) const;// Returns Display Pixel at (x, y)
+    bool isHires() const;                 // True in SUPER-CHIP 128x64 Mode
+    u_char getFault() const;              // Returns the Fault that Halted the CPU
+    const CHIP8State &getState() const;   // Returns the Entire Machine State
+    void setState(const CHIP8State &, const u_char * = nullptr);  // Replaces the Entire Machine State (and XO-CHIP Memory if Given)
+    void loadState(const CHIP8State &, uint64_t);  // Swaps in a State of a Core Running the same ROM, Keeping Decodes where Memory Matches
+    uint64_t saveState(CHIP8State &) const;  // Copies the State out (only Written Memory Pages), Returns the Written Pages
+    const CHIP8State &getBootState() const;  // Returns the State the ROM was Loaded with
+    const u_char *getBootMemory() const;  // Returns Memory as the ROM was Loaded (64KB in XO-CHIP Mode)
+    const CoreClone *clone(CloneArena &, const CoreClone * = nullptr) const;  // Copies the State into the Arena, Sharing Unchanged Pages
+    void restore(const CloneArena &, const CoreClone *);  // Replaces the State with a Clone's
+    uint64_t hashState() const;           // 64-bit Hash of the Entire Machine State
 
     void CLS();                            // 00E0 Clears the Screen
     void RET();                            // 00EE Return from Subroutine, return;
@@ -119,4 +398,19 @@ class CHIP8 {
     void LD(u_char);                       // FX33, Store BCD Representation of VX into I, I+1, I+2
     void LD(u_int16_t *, u_char);          // FX55, Store Values V0 - VX into Memory Starting at Location I
     void LD(u_char, u_int16_t *);          // FX65, Read Values V0 - VX from Memory Starting at Location I
+
+    void SCD(u_char);                      // 00CN, Scroll Display Down N Lines
+    void SCR();                            // 00FB, Scroll Display Right 4 Pixels
+    void SCL();                            // 00FC, Scroll Display Left 4 Pixels
+    void EXIT();                           // 00FD, Exit the Interpreter (Halts with FAULT_EXIT)
+    void LOW();                            // 00FE, Switch to 64x32 Display
+    void HIGH();                           // 00FF, Switch to 128x64 Display
+    void STR(u_char);                      // FX75, Store Values V0 - VX into the Flag Registers
+    void LDR(u_char);                      // FX85, Read Values V0 - VX from the Flag Registers
+
+    void SCU(u_char);                      // 00DN, Scroll Display Up N Lines
+    void SAVE(u_char, u_char);             // 5XY2, Store Values Vx - Vy into Memory Starting at Location I
+    void LOAD(u_char, u_char);             // 5XY3, Read Values Vx - Vy from Memory Starting at Location I
+    void PLANE(u_char);                    // FN01, Select Planes to Draw on
+    void AUDIO();                          // F002, Load the Audio Pattern from Memory Starting at Location I
 };
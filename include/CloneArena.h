@@ -0,0 +1,64 @@
+#ifndef YAC8_INTERPRETER_CLONEARENA_H
+#define YAC8_INTERPRETER_CLONEARENA_H
+
+#include <memory>
+#include <vector>
+
+#include "CHIP-8.h"
+
+#define CLONE_HEAD_SIZE offsetof(CHIP8State, display)  // Registers and Mode Line, Copied into every Clone
+#define CLONE_DISPLAY_PAGES (sizeof(CHIP8State::display) / DIRTY_PAGE_SIZE)
+#define CLONE_MEMORY_PAGES (MEMORY_SIZE / DIRTY_PAGE_SIZE)
+#define CLONE_PAGES (CLONE_DISPLAY_PAGES + CLONE_MEMORY_PAGES)
+#define CLONE_XO_PAGES ((XO_MEMORY_SIZE - MEMORY_SIZE) / DIRTY_PAGE_SIZE)  // XO-CHIP Memory Pages past the first 4KB
+#define CLONE_CHUNK_BLOCKS 1024  // Blocks per Arena Allocation (64KB)
+
+/**
+ * Copy of a Core's State inside a CloneArena
+ *  Display and Memory are Pages Shared with the Parent Clone
+ *  or the Boot Image wherever they're Unchanged. In XO-CHIP
+ *  Mode Memory Pages are the first 4KB, the rest of the 64KB
+ *  are in a Table of CLONE_XO_PAGES more Blocks
+ */
+struct alignas(DIRTY_PAGE_SIZE) CoreClone {
+    u_char head[CLONE_HEAD_SIZE];  // CHIP8State up to the Display
+    u_int32_t pages[CLONE_PAGES];  // Arena Block of each Display then Memory Page
+    uint64_t dirtyPages;           // Memory Pages that Differ from the Boot Image
+    u_int32_t xoPages;             // First Block of the XO-CHIP Page Table (0 in CHIP-8 Mode)
+};
+
+/**
+ * Bump Allocator for CoreClones and their Pages
+ *  - Blocks are DIRTY_PAGE_SIZE Bytes, Handed out of 64KB Chunks
+ *      so Cloning never calls malloc once the Arena has Grown
+ *  - The first Blocks hold the Boot Image's Display and Memory,
+ *      Shared by every Clone (ROM and Font are never Copied)
+ *  - Clones are Freed all at once by clear, Chunks are Kept
+ *  - reserveClones Grows it up Front, for Callers that mustn't
+ *      Allocate while Cloning (the Audio Thread)
+ */
+class CloneArena {
+  private:
+    struct alignas(DIRTY_PAGE_SIZE) Block {
+        u_char bytes[DIRTY_PAGE_SIZE];
+    };
+
+    std::vector<std::unique_ptr<Block[]>> chunks;
+    size_t used;                          // Blocks Handed out, including the Boot Image
+    size_t bootBlocks;                    // Blocks the Boot Image takes, Kept by clear
+    u_int32_t xoBoot;                     // First Block of XO-CHIP's Boot Memory past 4KB (0 in CHIP-8 Mode)
+
+  public:
+    CloneArena(const CHIP8 &core);        // Arena for Cores Running the same ROM in the same Mode as core
+
+    u_int32_t allocate(size_t bytes);     // First Block of a Contiguous Run covering bytes
+    u_char *block(u_int32_t index);
+    const u_char *block(u_int32_t index) const;
+    void clear();                         // Frees every Clone, Keeping the Boot Image and Chunks
+    void reserveClones(u_int32_t count);  // Grows so count Clones never Allocate Chunks
+    u_int32_t xoBootBlock() const;        // First Block of XO-CHIP's Boot Memory past 4KB
+    size_t bytesUsed() const;             // Bytes Handed out, Boot Image Included
+};
+
+
+#endif  //YAC8_INTERPRETER_CLONEARENA_H
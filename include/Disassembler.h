@@ -8,6 +8,9 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
 
 typedef unsigned char u_char;
 
@@ -15,11 +18,45 @@ typedef unsigned char u_char;
 typedef unsigned __int16 u_int16_t;
 #endif
 
+#define ROM_START 0x200  // Address ROMs are Loaded into Memory at
+
+// Per Address Classification of the ROM's Bytes
+enum ByteType : u_char {
+    BYTE_DATA = 0,    // Not Reached by Control Flow (Sprites, Tables, etc...)
+    BYTE_CODE,        // First Byte of an Instruction
+    BYTE_OPERAND      // Second Byte of an Instruction
+};
+
+// Straight Line run of Instructions with a Single Entry
+struct BasicBlock {
+    u_int16_t start;                    // Address of First Instruction
+    u_int16_t end;                      // Address Following the Last Instruction
+    std::vector<u_int16_t> successors;  // Addresses Control may Continue to
+    std::string label;                  // Label used in Disassembly
+    bool isSubroutine;                  // Block is the Target of a CALL
+};
+
+// Result of Static Control Flow Analysis on a ROM
+struct ProgramMap {
+    u_int16_t size;                            // ROM Size in Bytes
+    std::vector<u_char> byteMap;               // ByteType per ROM Byte (Index 0 = ROM_START)
+    std::map<u_int16_t, BasicBlock> blocks;    // Basic Blocks by Start Address
+    bool hasIndirectJump;                      // BNNN Found, Targets only Partially Known
+
+    bool isCode(u_int16_t addr) const;         // Address is the Start of an Instruction
+};
+
 class Disassembler {
   private:
+    bool writeInstruction(unsigned short opcode, unsigned short param, std::ostream& out);  // Outputs Mnemonic, False if not an Instruction
+
   public:
     void hexDump(char filePath[], std::ostream& out);
     void disassemble(char filePath[], std::ostream& out);
+    bool readROM(char filePath[], std::vector<u_char>& rom);  // Reads ROM's Bytes in a Single Read
+
+    ProgramMap analyze(char filePath[]);                    // Analyzes ROM from File
+    ProgramMap analyze(const u_char* rom, u_int16_t size);  // Recursive Traversal from ROM_START
 };
 
 
@@ -4,30 +4,88 @@
 #define DISPLAY_KEY_DEBUG 0   // On Keypress Console Verbose
 #define DISPLAY_DEBUG_MODE 1  // Debug Mode Enable (F1 Key Outputs)
 #define DRAW_RATE 4           // Rate at which Draw is called (Default)
+#define RUN_AHEAD_MAX 4       // Most Frames Run-Ahead may Emulate past the Real State
+#define RUN_AHEAD_REPORT 600  // Frames between Run-Ahead Overhead Reports (10s)
 
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <fstream>
 #include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <thread>
 #include <vector>
 
+#include "Audio.h"
 #include "CHIP-8.h"
+#include "CloneArena.h"
+#include "FrameTrace.h"
+#include "LatencyProbe.h"
 #include "SimpleRender/SimpleRender.h"
+#include "TripleBuffer.h"
 #include <SDL2/SDL_ttf.h>
 
+// Completed Frame handed from the CPU Thread to the Render Thread
+struct Frame {
+    uint64_t display[DISPLAY_PLANES][DISPLAY_HIRES_HEIGHT][2];  // Packed Bitplanes, same Layout as CHIP8State::display
+    bool hires;                                                 // SUPER-CHIP 128x64 Mode
+    u_int32_t latencyTag;                                       // Press this Frame Shows (LatencyProbe::onPublish, 0 if None)
+};
+
 class Display : SimpleRender {
   private:    // Debug Menu Configuration
-    bool isDebugMode = false;                  // Enables Debug Options
-    bool isLoop, isStep;                       // Steps through or loops Through CPU Run
+    std::atomic<bool> isDebugMode{false};      // Enables Debug Options (Cleared by the Render Thread if the Font Fails)
+    std::atomic<bool> isLoop, isStep;          // Steps through or loops Through CPU Run
     std::stringstream *out;                    // Used to store Output Stream from CPU
     std::deque<std::string> instructionWindow; // Window of Previous N Instructions
     u_char *debugBuffer;                       // Debug Buffer Screen Area (Used for Borders)
     SDL_Texture *debugTexture;                 // Texture to use on Debug Area
     SDL_Rect debugArea, instrArea, drawArea;   // Split up Draw and Debug Areas
+    SDL_Texture *hiresTexture;                 // 128x64 Texture for SUPER-CHIP Mode
+    bool isHiresShown = false;                 // Last Uploaded Frame was 128x64
+    u_int32_t palette[4] = {                   // Pixel Colors by Plane Bits (compositeDisplay)
+        0x000000,   // Off
+        0xFFFFFF,   // Plane 1
+        0xAAAAAA,   // Plane 2 (XO-CHIP)
+        0x555555    // Both Planes (XO-CHIP)
+    };
 
   private:    // Private Variables
     int drawRate;                              // Speed at which CHIP8 will Run (Multiplier)
+    std::atomic<bool> isRunning;               // CPU Thread Runs while True
+    std::mutex cpuMutex;                       // Guards CPU State shared with Debug Menu
+    TripleBuffer<Frame> frames;                // Completed Frames from CPU Thread
+    Audio audio;                               // Buzzer, Gated by the CPU Thread's Sound Timer
+    bool isAudioPaced;                         // Audio Device Clocks Emulation if it Opens
+    bool isAudioClocked;                       // Audio Device is Clocking Emulation (No CPU Thread)
+    std::chrono::steady_clock::time_point nextPresent;  // Next 60Hz Tick to Present on
+
+  private:    // Run-Ahead, Presents N Frames past the Real State then Rewinds
+    int runAheadFrames = 0;                    // Frames Emulated Ahead (0 = Off)
+    std::unique_ptr<CloneArena> runAheadArena; // Holds the Real State while Running Ahead (Reserved up Front)
+    uint64_t runAheadTotal = 0, runAheadMax = 0;  // Overhead since the Last Report (ns)
+    int runAheadCount = 0;                     // Frames since the Last Report
+    std::atomic<uint64_t> runAheadReport;      // Average << 32 | Max Overhead (ns) for the Render Thread to Log, 0 if None
+
+  private:    // Late Input, Keys are Latched when the CPU Reads them
+    std::atomic<u_int16_t> keyMask;            // Keys Held, Bit N = Key 0xN (Written by onKey, the Only Key State it Writes)
+    bool isLateInput;                          // CPU Reads keyMask through readKeys instead of Copying it each Frame
+
+  private:    // Input to Present Latency
+    LatencyProbe latency;                      // Follows Presses from Key Event to Present
+    bool isLatencyProbed;                      // Presses are Followed (Key Reads Stamped by observeKeys)
+    std::string latencyFile;                   // Stats Written here on Exit (Empty for Title Bar only)
+    char latencyText[64] = "";                 // Title Bar Summary
+    u_int32_t latencyShown = 0;                // Presses in latencyText
+
+  private:    // Frame Phase Tracing
+    std::unique_ptr<FrameTrace> trace;         // Phase Timings (NULL if not Tracing)
+    std::string traceFile;                     // Chrome Trace JSON Written here on Exit
 
   private:
     CHIP8 *cpu;
@@ -51,6 +109,15 @@ class Display : SimpleRender {
         SDLK_w        // 0xF
     };
 
+  private:    // Private Static Methods (Threads)
+    static void handleCPU(Display *parent);       // Steps CPU at 60Hz off the System Clock
+    static void emulateFrame(void *parent);       // Steps a Frame and Publishes it (AudioFrameCallback)
+    void publishFrame();                          // Hands the CPU's Display to the Render Thread
+    void runAhead();                              // Publishes the Frame runAheadFrames Ahead, then Rewinds
+    static u_int16_t readKeys(void *parent);      // Key Provider, Returns keyMask (KeyProvider)
+    static void observeKeys(u_int16_t mask, void *parent);  // Key Observer, Stamps the Read for latency (KeyObserver)
+    void traceSpan(TracePhase, TraceThread, FrameTrace::Time start);  // Records a Phase Ending Now (if Tracing)
+
   private:                                        // 2D SimpleRender Overloaded Methods
     void Draw();                                  // Main Draw location of Application
     void Preload();                               // Overrided Preload, initiate Display
@@ -58,14 +125,20 @@ class Display : SimpleRender {
     void onMouse(double, double){};               // On Mouse Movement
     void onMouseClick(SDL_MouseButtonEvent &){};  // On Mouse Click
     void onMouseScroll(double, double){};         // On Mouse Scroll
+    void onEventPolled(std::chrono::steady_clock::time_point);  // Times Event Handling
 
 
   public:
     Display(CHIP8 *, u_int8_t upscale);
     ~Display();
 
-    void enableDebugMode(); // Enables Debug Mode
-    void setDrawRate(int);  // Sets the Draw Rate
+    void enableDebugMode();    // Enables Debug Mode
+    void setDrawRate(int);     // Sets the Draw Rate
+    void setAudioPacing(bool); // Paces Emulation by the Audio Clock
+    void setRunAhead(int);     // Frames to Run Ahead of the Real State (0 = Off, Load the ROM first)
+    void setLateInput(bool);   // Latches Keys as SKP/SKNP/FX0A Run
+    void setLatencyStats(const std::string &);  // Measures Input to Present Latency, Stats File Written on Exit
+    void setTrace(const std::string &);         // Times Frame Phases, Chrome Trace JSON Written on Exit
     void run();
 };
 
@@ -0,0 +1,69 @@
+#ifndef YAC8_INTERPRETER_FRAMETRACE_H
+#define YAC8_INTERPRETER_FRAMETRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <stdint.h>
+
+#include "types.h"
+
+#define TRACE_CAPACITY 65536  // Spans Kept (Power of 2), Oldest are Overwritten (~15s at 60Hz)
+
+// Timed Parts of a Frame
+enum TracePhase : u_char {
+    TRACE_EVENTS = 0,   // Event Thread, Polling and Dispatching an SDL Event
+    TRACE_CPU,          // CPU Thread, Stepping a Frame's Instructions
+    TRACE_RUN_AHEAD,    // CPU Thread, Cloning, Running Ahead, and Restoring
+    TRACE_WAIT,         // Render Thread, Sleeping until the Next 60Hz Tick
+    TRACE_CONVERT,      // Render Thread, Compositing the Frame into the Texture
+    TRACE_OVERLAY,      // Render Thread, Drawing the Debug Menu
+    TRACE_PRESENT,      // Render Thread, SDL_RenderPresent
+    TRACE_FRAME,        // Render Thread, all of Draw (Frame Time)
+    TRACE_PHASES
+};
+
+// Threads Spans are Recorded on (Chrome Trace tid)
+enum TraceThread : u_char {
+    TRACE_THREAD_RENDER = 1,
+    TRACE_THREAD_CPU,       // CPU Thread, or the Audio Thread when it Clocks Emulation
+    TRACE_THREAD_EVENTS
+};
+
+// One Timed Span
+struct TraceSpan {
+    uint64_t start;     // Nanoseconds since the Trace Started
+    u_int32_t duration; // Nanoseconds
+    u_char phase;       // TracePhase
+    u_char thread;      // TraceThread
+};
+
+/**
+ * High Resolution Timings of each Frame Phase
+ *  - Any Thread Records into one Ring, Claiming a Slot with
+ *      a single fetch_add so Recording never Locks or Waits
+ *  - Read once every Thread has Stopped: Exported as Chrome
+ *      Trace Event JSON (chrome://tracing, Perfetto), and as
+ *      p50/p99 per Phase with a Frame Time Histogram
+ */
+class FrameTrace {
+  private:
+    std::unique_ptr<TraceSpan[]> spans;      // Ring of TRACE_CAPACITY Spans
+    std::atomic<uint64_t> recorded;          // Spans Claimed, Slot is recorded % TRACE_CAPACITY
+    std::chrono::steady_clock::time_point origin;  // Trace Start
+
+  public:
+    typedef std::chrono::steady_clock::time_point Time;
+
+    FrameTrace();
+
+    static Time now();
+    void record(TracePhase, TraceThread, Time start, Time end);  // Any Thread
+
+    bool writeChrome(const char *path) const;  // Trace Event JSON, False if the File won't Open
+    void report(std::ostream &) const;         // Percentiles per Phase and the Frame Time Histogram
+};
+
+
+#endif  //YAC8_INTERPRETER_FRAMETRACE_H
@@ -0,0 +1,110 @@
+#ifndef YAC8_INTERPRETER_HASH_H
+#define YAC8_INTERPRETER_HASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * 64-bit Non-Cryptographic Hash (xxHash64 Algorithm)
+ *  - Four Independent Lanes over 32 Byte Stripes so
+ *      the Compiler can keep them all in Flight
+ *  - Used for ROM Content Hashes and State Hashes
+ */
+namespace Hash {
+    const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+    const uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+    inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    inline uint64_t read64(const unsigned char *p) {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint32_t read32(const unsigned char *p) {
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint64_t round(uint64_t acc, uint64_t input) {
+        acc += input * PRIME2;
+        acc = rotl(acc, 31);
+        return acc * PRIME1;
+    }
+
+    inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+        acc ^= round(0, val);
+        return acc * PRIME1 + PRIME4;
+    }
+
+    /**
+     * Hashes the given Bytes
+     *
+     * @param data - Pointer to the Bytes
+     * @param len - Number of Bytes
+     * @param seed - Hash Seed
+     */
+    inline uint64_t hash64(const void *data, size_t len, uint64_t seed = 0) {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        const unsigned char *end = p + len;
+        uint64_t h;
+
+        if (len >= 32) {
+            uint64_t v1 = seed + PRIME1 + PRIME2;
+            uint64_t v2 = seed + PRIME2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - PRIME1;
+
+            // Stripes of 32 Bytes, one 8 Byte Word per Lane
+            const unsigned char *limit = end - 32;
+            do {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            h = mergeRound(h, v1);
+            h = mergeRound(h, v2);
+            h = mergeRound(h, v3);
+            h = mergeRound(h, v4);
+        } else {
+            h = seed + PRIME5;
+        }
+
+        h += uint64_t(len);
+
+        // Remaining Tail
+        for (; p + 8 <= end; p += 8) {
+            h ^= round(0, read64(p));
+            h = rotl(h, 27) * PRIME1 + PRIME4;
+        }
+        if (p + 4 <= end) {
+            h ^= uint64_t(read32(p)) * PRIME1;
+            h = rotl(h, 23) * PRIME2 + PRIME3;
+            p += 4;
+        }
+        for (; p < end; p++) {
+            h ^= (*p) * PRIME5;
+            h = rotl(h, 11) * PRIME1;
+        }
+
+        // Avalanche
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        return h;
+    }
+}
+
+
+#endif  //YAC8_INTERPRETER_HASH_H
@@ -0,0 +1,65 @@
+#ifndef YAC8_INTERPRETER_LATENCYPROBE_H
+#define YAC8_INTERPRETER_LATENCYPROBE_H
+
+#include <atomic>
+#include <iosfwd>
+#include <stdint.h>
+
+#include "types.h"
+
+#define LATENCY_SAMPLES 1024     // Most Recent Presses kept for the Percentiles
+#define LATENCY_TIMEOUT 1000000000ULL  // Presses Nothing Reads for 1s are Dropped (ns)
+
+// Where the Press being Followed has Reached
+enum LatencyStage : u_char {
+    LATENCY_IDLE = 0,   // Waiting for a Press
+    LATENCY_PRESSED,    // Key Event Seen, ROM hasn't Read the Key yet
+    LATENCY_READ,       // ROM Read the Key, no Frame Drawn since
+    LATENCY_DRAWN       // Frame Drawn after the Read was Published, not yet Presented
+};
+
+// Phases of one Press, Microseconds
+struct LatencySample {
+    u_int32_t read;     // Key Event to the Instruction that Read it
+    u_int32_t draw;     // Read to the Frame Drawn after it
+    u_int32_t present;  // Frame Drawn to SDL_RenderPresent
+    u_int32_t total;    // Key Event to SDL_RenderPresent
+};
+
+/**
+ * Follows Key Presses from the Key Event to the Present
+ *  that Shows them, one Press at a time
+ *  - Each Hand-off is Lock-Free, Stamped by the Thread at
+ *      that Stage (Event, CPU, then Render Thread)
+ *  - Frames Published while a Press is Drawn carry it's
+ *      Sequence, so the Render Thread Stops the Clock on
+ *      whichever Frame it Presents first
+ *  - Samples are Owned by the Render Thread
+ */
+class LatencyProbe {
+  private:
+    std::atomic<uint64_t> progress;    // Press Sequence << 8 | LatencyStage
+    std::atomic<u_int16_t> keyBit;     // Key being Followed, Bit N = Key 0xN
+    std::atomic<uint64_t> pressTime, readTime, drawTime;  // steady_clock Nanoseconds per Stage
+
+    LatencySample samples[LATENCY_SAMPLES];  // Ring of the Most Recent Presses
+    u_int32_t count;                   // Presses Completed (Ring Holds the Last LATENCY_SAMPLES)
+
+    static u_int32_t percentile(u_int32_t LatencySample::*, const LatencySample *, u_int32_t, double);
+
+  public:
+    LatencyProbe();
+
+    static uint64_t now();                  // steady_clock Nanoseconds
+    void onPress(u_char key);               // Event Thread, a Mapped Key went Down
+    void onRead(u_int16_t mask);            // CPU Thread, the ROM Latched these Keys
+    u_int32_t onPublish();                  // CPU Thread, a Frame was Drawn, Returns the Sequence to Tag it with (0 if None)
+    void onPresent(u_int32_t tag);          // Render Thread, a Frame with this Tag was just Presented
+
+    u_int32_t getCount() const;             // Presses Completed
+    void summary(char *buffer, size_t size) const;  // Total Latency p50/p95/p99 for the Title Bar
+    void report(std::ostream &) const;      // Every Phase's p50/p95/p99
+};
+
+
+#endif  //YAC8_INTERPRETER_LATENCYPROBE_H
@@ -42,6 +42,10 @@ void SimpleRender::onMouseScroll(double xOffset, double yOffset) {
     printf("SCROLL: X-off[%.2f], Y-off[%.2f]\n", xOffset, yOffset);
 }
 
+void SimpleRender::onEventPolled(std::chrono::steady_clock::time_point) {
+    // Nothing to Time by Default
+}
+
 /**
  ***********************************************************
  * Private Static Methods Backend
@@ -160,6 +164,7 @@ void SimpleRender::InitRender() {
  */
 void SimpleRender::handleEventPolling(SDL_Event *windowEvent, SimpleRender *parent) {
     while(true) {
+        auto pollStart = std::chrono::steady_clock::now();
         if (SDL_PollEvent(windowEvent)) {
             // Check if close button was clicked
             if (windowEvent->type == SDL_QUIT) { 
@@ -191,6 +196,8 @@ void SimpleRender::handleEventPolling(SDL_Event *windowEvent, SimpleRender *pare
             default:
                 break;
             }
+
+            parent->onEventPolled(pollStart);
         }
 
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
@@ -5,6 +5,7 @@
 #include <string.h>
 #include "../types.h"
 
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -43,6 +44,7 @@ class SimpleRender {
     virtual void onMouseClick(SDL_MouseButtonEvent &m);
     virtual void onMouse(double xPos, double yPos);
     virtual void onMouseScroll(double xOffset, double yOffset);
+    virtual void onEventPolled(std::chrono::steady_clock::time_point start);  // Event Thread, after an Event was Handled
 
   private:    // Private Static Methods (Threads)
     static void handleEventPolling(SDL_Event *windowEvent, SimpleRender *parent);
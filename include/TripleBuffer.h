@@ -0,0 +1,60 @@
+#ifndef YAC8_INTERPRETER_TRIPLEBUFFER_H
+#define YAC8_INTERPRETER_TRIPLEBUFFER_H
+
+#include <atomic>
+
+/**
+ * Lock-Free Single Producer/Single Consumer Triple Buffer
+ *  - Writer fills the Back Buffer then Publishes it
+ *  - Reader picks up the Newest Published Buffer
+ *  - Neither side ever waits on the other, buffers are
+ *      handed off by swapping a single shared Index
+ */
+template <typename T>
+class TripleBuffer {
+  private:
+    static const unsigned char FRESH_BIT = 0x4;  // Set on Shared Index when Unread Data Published
+    static const unsigned char INDEX_MASK = 0x3;
+
+    T buffers[3];                        // Front, Shared, and Back Buffers
+    std::atomic<unsigned char> shared;   // Index of Shared Buffer | FRESH_BIT
+    unsigned char front;                 // Reader Owned Index
+    unsigned char back;                  // Writer Owned Index
+
+  public:
+    TripleBuffer() : buffers(), shared(1), front(0), back(2) {}
+
+    /**
+     * Returns the Writer's Buffer to fill in
+     *  Only to be used from the Writer Thread
+     */
+    T &writeBuffer() { return buffers[back]; }
+
+    /**
+     * Publishes the Writer's Buffer as the Newest Complete
+     *  Buffer, swapping in the Shared Buffer to write into next
+     */
+    void publish() {
+        back = shared.exchange(back | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    /**
+     * Swaps in the Newest Published Buffer to be Read
+     *  Only to be used from the Reader Thread
+     * @returns True if a new Buffer was picked up
+     */
+    bool update() {
+        if (!(shared.load(std::memory_order_relaxed) & FRESH_BIT))
+            return false;
+        front = shared.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * Returns the Reader's Buffer (Last Buffer picked up by update)
+     */
+    const T &readBuffer() const { return buffers[front]; }
+};
+
+
+#endif  //YAC8_INTERPRETER_TRIPLEBUFFER_H
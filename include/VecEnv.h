@@ -0,0 +1,115 @@
+#ifndef YAC8_INTERPRETER_VECENV_H
+#define YAC8_INTERPRETER_VECENV_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CHIP-8.h"
+
+#define ENV_FRAME_SKIP 4            // Frames each Step Runs (Default)
+#define ENV_IPF 10                  // Instructions per Frame (Default)
+#define ENV_OBS_WORDS (DISPLAY_HIRES_HEIGHT * 2)  // Packed Observation Words per Instance (128x64, Plane 1)
+
+// Reward += scale * Change in a Memory Byte over the Step
+struct RewardHook {
+    u_int16_t addr;  // Memory Address Read
+    float scale;     // Reward per Unit the Byte Grew
+};
+
+// Episode is Done once a Memory Byte Equals value
+struct DoneHook {
+    u_int16_t addr;  // Memory Address Read
+    u_char value;    // Value that Ends the Episode
+};
+
+// Instance's Bookkeeping, a Cache Line of it's own
+struct alignas(64) EnvSlot {
+    uint64_t seed;          // Seed of the Current Episode
+    uint64_t dirtyPages;    // Memory Pages Written since Boot (CHIP8::saveState)
+    u_int32_t frameCount;   // Frames since Reset
+    u_char isDone;          // Episode Finished on the Last Step
+};
+
+// Reward Hook Bytes at the Last Step, Instances take whole Lines
+struct alignas(64) HookLine {
+    u_char values[64];
+};
+
+/**
+ * Vectorized Environment for Training Agents
+ *  - Every Instance is a CHIP8State, all Stored Contiguously.
+ *      Each Thread Steps its Instances on one Runner Core, Copied
+ *      from the Prewarmed Prototype, Swapping States in and out so
+ *      Instances Share the Decode Cache and Boot Image
+ *  - Steps take a Key Mask per Instance, Run frameSkip
+ *      Frames, and Return the Packed Display, Reward, and Done
+ *  - Instances Run in CHIP-8 Mode, SUPER-CHIP Included, so the
+ *      Observation is Plane 1 at 128x64 (XO-CHIP's Plane 2 is
+ *      never Drawn). 64x32 Frames fill it's Top Left Quarter
+ *  - Instances are Split into Contiguous Slices, one per
+ *      Thread. States, Slots, and Hook Lines are each Cache
+ *      Line Aligned, so Threads only Share Lines at Slice
+ *      Edges of the Caller's rewards and dones Arrays
+ *  - Done Instances Reset at the start of their Next Step
+ */
+class VecEnv {
+  private:
+    CHIP8 prototype;                     // ROM Loaded and Prewarmed, Copied into each Runner
+    std::vector<CHIP8> runners;          // Core each Slice Runs its Instances on
+    std::vector<CHIP8State> states;      // Every Instance, Contiguous
+    std::vector<EnvSlot> slots;          // Each Instance's Bookkeeping
+    std::vector<HookLine> hookValues;    // Reward Hook Bytes, hookLines per Instance
+    size_t hookLines;                    // Lines per Instance, Fitting every Reward Hook
+    std::vector<RewardHook> rewardHooks;
+    std::vector<DoneHook> doneHooks;
+    u_int32_t frameSkip, ipf, maxFrames;
+
+    // Job Handed to every Slice (actions NULL on Reset)
+    const uint64_t *jobSeeds;
+    const u_int16_t *jobActions;
+    uint64_t *jobObs;
+    float *jobRewards;
+    u_char *jobDones;
+
+    // Worker Pool, Slice 0 Runs on the Calling Thread
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable wake, finished;
+    uint64_t generation;                 // Bumped per Job
+    u_int32_t pending;                   // Workers still Running the Job
+    bool isStopping;
+
+    void workerLoop(u_int32_t slice);
+    void stopWorkers();                  // Stops and Joins every Worker Started
+    void runJob();                       // Runs the Job over every Slice, Returns once all are Done
+    void runSlice(u_int32_t slice);
+    void resetInstance(CHIP8 &runner, size_t i, uint64_t seed);
+    void stepInstance(CHIP8 &runner, size_t i);
+    void observe(size_t i, uint64_t *obs) const;
+    u_char &hookValue(size_t i, size_t hook);  // Instance i's Last Value of a Reward Hook
+    u_char memVal(size_t i, u_int16_t addr) const;  // Instance i's Memory Byte at Address
+
+  public:
+    VecEnv(u_int32_t count, u_int32_t threads = 0);  // 0 Threads uses every Hardware Thread
+    ~VecEnv();
+    VecEnv(const VecEnv &) = delete;
+    VecEnv &operator=(const VecEnv &) = delete;
+
+    bool loadROM(const u_char *rom, size_t size);  // Loads every Instance, False if it doesn't Fit
+    void setFrameSkip(u_int32_t frames);            // Frames per Step (Default ENV_FRAME_SKIP)
+    void setIPF(u_int32_t instructions);            // Instructions per Frame (Default ENV_IPF)
+    void setMaxFrames(u_int32_t frames);            // Episodes are Done after this many Frames (0 = Never)
+    void addRewardHook(u_int16_t addr, float scale);
+    void addDoneHook(u_int16_t addr, u_char value);
+
+    void reset(const uint64_t *seeds, uint64_t *obs);
+    void step(const u_int16_t *actions, uint64_t *obs, float *rewards, u_char *dones);
+
+    size_t size() const;                            // Number of Instances
+    const CHIP8State &getState(size_t i) const;     // Instance i's Machine State
+};
+
+
+#endif  //YAC8_INTERPRETER_VECENV_H
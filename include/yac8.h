@@ -0,0 +1,174 @@
+#ifndef YAC8_INTERPRETER_YAC8_H
+#define YAC8_INTERPRETER_YAC8_H
+
+/**
+ * yac8_core C Interface
+ *  - Embeds the CHIP-8 Interpreter without SDL, TTF, or spdlog
+ *  - All Functions operate on an Opaque Core Handle
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(YAC8_SHARED)
+#ifdef YAC8_BUILDING_CORE
+#define YAC8_API __declspec(dllexport)
+#else
+#define YAC8_API __declspec(dllimport)
+#endif
+#else
+#define YAC8_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define YAC8_DISPLAY_WIDTH 64
+#define YAC8_DISPLAY_HEIGHT 32
+#define YAC8_HIRES_WIDTH 128   // SUPER-CHIP High Resolution
+#define YAC8_HIRES_HEIGHT 64
+
+#define YAC8_MODE_CHIP8 0      // CHIP-8 and SUPER-CHIP, 4KB Memory
+#define YAC8_MODE_XO_CHIP 1    // XO-CHIP, 64KB Memory and 2 Bitplanes
+
+typedef struct yac8_t yac8_t;                    // Interpreter Core
+typedef struct yac8_snapshot_t yac8_snapshot_t;  // Saved Copy of a Core's State
+typedef struct yac8_env_t yac8_env_t;            // Vectorized Environment of many Cores
+typedef struct yac8_arena_t yac8_arena_t;        // Allocator for Clones, Freed all at once
+typedef struct yac8_clone_t yac8_clone_t;        // Copy-on-Write Copy of a Core's State in an Arena
+
+/* Lifetime */
+YAC8_API yac8_t *yac8_create(void);   // Creates a Core, NULL on Failure
+YAC8_API void yac8_destroy(yac8_t *core);
+
+/**
+ * Picks the Machine the Core Runs as, Clearing it (Load the ROM after)
+ * @returns 0 on Success, -1 on an Unknown Mode
+ */
+YAC8_API int yac8_set_mode(yac8_t *core, int mode);  // -1 also if XO-CHIP's Memory can't be Allocated
+
+/**
+ * Loads a ROM from a Buffer into the Core's Memory at 0x200
+ * @returns 0 on Success, -1 if the ROM doesn't fit in Memory
+ */
+YAC8_API int yac8_load_rom(yac8_t *core, const uint8_t *rom, size_t size);
+YAC8_API void yac8_reset(yac8_t *core);  // Restores the State right after the Last yac8_load_rom
+YAC8_API void yac8_seed(yac8_t *core, uint64_t seed);  // Seeds CXKK's Random Generator, Kept across yac8_reset
+
+/* Execution */
+YAC8_API void yac8_step(yac8_t *core, uint32_t count);  // Runs count Instructions
+
+/**
+ * Runs a Frame of the given Instructions per Frame
+ * @returns 1 if the Display Changed during the Frame, 0 otherwise
+ */
+YAC8_API int yac8_run_frame(yac8_t *core, uint32_t instructions);
+
+/**
+ * Reads the Fault that Halted the Core
+ * @returns 0 if Running, 1 on Stack Overflow, 2 on Stack Underflow, 3 on Exit (00FD)
+ */
+YAC8_API int yac8_get_fault(const yac8_t *core);
+
+/**
+ * Hashes the Entire Machine State (Registers, Stack, Display, and Memory)
+ *  Equal Hashes mean Equal States, compare once per Frame to find Desyncs
+ */
+YAC8_API uint64_t yac8_state_hash(const yac8_t *core);
+
+/* Input */
+YAC8_API void yac8_set_keys(yac8_t *core, uint16_t keyMask);  // Bit N = Key 0xN Pressed
+
+/**
+ * Latches Keys Late, provider is Called for the Current Key Mask
+ *  each time EX9E, EXA1, or FX0A Runs, overriding yac8_set_keys
+ *  Pass NULL to go back to yac8_set_keys
+ */
+typedef uint16_t (*yac8_key_provider_t)(void *userdata);
+YAC8_API void yac8_set_key_provider(yac8_t *core, yac8_key_provider_t provider, void *userdata);
+
+/**
+ * Reads the Display (Plane 1) Packed 1-bit per Pixel
+ *  rows[y] Bit 63 is x = 0, Bit 0 is x = 63
+ */
+YAC8_API void yac8_get_framebuffer(const yac8_t *core, uint64_t rows[YAC8_DISPLAY_HEIGHT]);
+
+YAC8_API int yac8_is_hires(const yac8_t *core);  // 1 in SUPER-CHIP 128x64 Mode, 0 in 64x32
+
+/**
+ * Reads the 128x64 Display Packed 1-bit per Pixel
+ *  rows[y * 2] Bit 63 is x = 0, rows[y * 2 + 1] Bit 0 is x = 127
+ *  In 64x32 Mode only the Top Left Quarter is Used
+ */
+YAC8_API void yac8_get_framebuffer_hires(const yac8_t *core, uint64_t rows[YAC8_HIRES_HEIGHT * 2]);
+
+/**
+ * Reads the Display as 32-bit Pixels, all Planes Composited through
+ *  palette[Plane 1 Bit | Plane 2 Bit << 1]. 64x32 Pixels, or 128x64 if yac8_is_hires
+ */
+YAC8_API void yac8_get_pixels(const yac8_t *core, const uint32_t palette[4], uint32_t *pixels);
+
+/* Snapshots */
+YAC8_API yac8_snapshot_t *yac8_snapshot_create(const yac8_t *core);          // Saves Core State, NULL on Failure
+
+/**
+ * Restores a Core Running the same ROM to the Snapshot's State
+ * @returns 0 on Success, -1 if the Core is in a different Mode
+ */
+YAC8_API int yac8_snapshot_restore(yac8_t *core, const yac8_snapshot_t *snapshot);
+YAC8_API void yac8_snapshot_destroy(yac8_snapshot_t *snapshot);
+
+/* Clones (Tree Search) */
+YAC8_API yac8_arena_t *yac8_arena_create(const yac8_t *core);  // Arena for Cores Running core's ROM, NULL on Failure
+YAC8_API void yac8_arena_destroy(yac8_arena_t *arena);
+YAC8_API void yac8_arena_clear(yac8_arena_t *arena);            // Frees every Clone in the Arena
+YAC8_API size_t yac8_arena_bytes(const yac8_arena_t *arena);    // Bytes in use, Boot Image Included
+
+/**
+ * Clones the Core into the Arena, Sharing every Page that Matches parent
+ *  (NULL Shares with the Boot Image). Clones Stepped from parent are Smallest
+ * @returns Clone Valid until yac8_arena_clear, NULL if the Arena couldn't Grow
+ */
+YAC8_API const yac8_clone_t *yac8_clone(yac8_arena_t *arena, const yac8_t *core, const yac8_clone_t *parent);
+YAC8_API void yac8_clone_restore(yac8_t *core, const yac8_arena_t *arena, const yac8_clone_t *clone);
+
+/* Vectorized Environments */
+#define YAC8_ENV_OBS_WORDS 128  // Packed Observation Words per Instance, as yac8_get_framebuffer_hires
+
+/**
+ * Creates count Instances Running the ROM, Stepped over threads Threads
+ *  (0 for every Hardware Thread). Instances are Stored Contiguously
+ *  and Run in CHIP-8 Mode (SUPER-CHIP Included, XO-CHIP isn't Supported)
+ * @returns NULL if the ROM doesn't fit in Memory, or on Failure
+ */
+YAC8_API yac8_env_t *yac8_env_create(const uint8_t *rom, size_t size, uint32_t count, uint32_t threads);
+YAC8_API void yac8_env_destroy(yac8_env_t *env);
+
+YAC8_API void yac8_env_set_frame_skip(yac8_env_t *env, uint32_t frames);      // Frames per Step (Default 4)
+YAC8_API void yac8_env_set_ipf(yac8_env_t *env, uint32_t instructions);       // Instructions per Frame (Default 10)
+YAC8_API void yac8_env_set_max_frames(yac8_env_t *env, uint32_t frames);      // Episode Length Limit (0 = None)
+YAC8_API int yac8_env_add_reward(yac8_env_t *env, uint16_t addr, float scale);  // Reward += scale * Change in RAM[addr], -1 on Failure
+YAC8_API int yac8_env_add_done(yac8_env_t *env, uint16_t addr, uint8_t value);  // Done once RAM[addr] == value, -1 on Failure
+
+/**
+ * Starts a new Episode on every Instance
+ *  seeds[i] Seeds Instance i (NULL Seeds it with i)
+ *  obs is Filled with YAC8_ENV_OBS_WORDS Words per Instance (NULL to Skip)
+ */
+YAC8_API void yac8_env_reset(yac8_env_t *env, const uint64_t *seeds, uint64_t *obs);
+
+/**
+ * Steps every Instance, Holding the Key Mask actions[i] for the Step's Frames
+ *  obs, rewards, and dones are Filled per Instance (any may be NULL)
+ *  Done Instances are Reset at the start of their Next Step
+ */
+YAC8_API void yac8_env_step(yac8_env_t *env, const uint16_t *actions, uint64_t *obs, float *rewards,
+                            uint8_t *dones);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  //YAC8_INTERPRETER_YAC8_H
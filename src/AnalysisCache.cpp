@@ -0,0 +1,241 @@
+#include "../include/AnalysisCache.h"
+#include "../include/Hash.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+using namespace std;
+
+// Start of every Cache File, followed by byteMap[size],
+//  blockCount CacheBlocks, then successorCount u_int16_t's
+struct CacheHeader {
+    char magic[4];              // "Y8AC"
+    u_int16_t version;          // ANALYSIS_CACHE_VERSION
+    u_int16_t size;             // ROM Size in Bytes
+    uint64_t romHash;           // Hash of the ROM's Bytes
+    u_int32_t blockCount;       // Number of Basic Blocks
+    u_int32_t successorCount;   // Total Successors over all Blocks
+    u_char hasIndirectJump;     // ProgramMap::hasIndirectJump
+    u_char reserved[7];
+};
+
+struct CacheBlock {
+    u_int16_t start;
+    u_int16_t end;
+    u_int16_t successorCount;
+    u_char isSubroutine;
+    u_char reserved;
+};
+
+static const char CACHE_MAGIC[4] = {'Y', '8', 'A', 'C'};
+
+
+/**
+ * Constructs a Cache over the given Directory
+ *  Directory is Created on the first store
+ *
+ * @param dir - Cache Directory
+ */
+AnalysisCache::AnalysisCache(const std::string &dir) : dir(dir) {}
+
+/**
+ * Returns the Default Cache Directory
+ *  $XDG_CACHE_HOME/yac8, ~/.cache/yac8, or .yac8-cache
+ */
+std::string AnalysisCache::defaultDir() {
+    const char *xdg = getenv("XDG_CACHE_HOME");
+    if (xdg && *xdg) return string(xdg) + "/yac8";
+
+    const char *home = getenv("HOME");
+    if (home && *home) return string(home) + "/.cache/yac8";
+    return ".yac8-cache";
+}
+
+/**
+ * File Path of the Cache Entry for a ROM
+ */
+std::string AnalysisCache::entryPath(uint64_t romHash) const {
+    stringstream name;
+    name << hex << setw(16) << setfill('0') << romHash << ".y8ac";
+    return (fs::path(dir) / name.str()).string();
+}
+
+/**
+ * Parses a Cache File's Bytes into a ProgramMap
+ *  Every Length is Checked against the File Size first
+ *
+ * @returns False if the Bytes are not a Valid Entry for the ROM
+ */
+static bool parseEntry(const u_char *data, size_t length, uint64_t romHash, ProgramMap &map) {
+    CacheHeader header;
+    if (length < sizeof(header)) return false;
+    memcpy(&header, data, sizeof(header));
+
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) || header.version != ANALYSIS_CACHE_VERSION ||
+        header.romHash != romHash)
+        return false;
+
+    size_t expected = sizeof(header) + header.size + size_t(header.blockCount) * sizeof(CacheBlock) +
+                      size_t(header.successorCount) * sizeof(u_int16_t);
+    if (length != expected) return false;
+
+    const u_char *p = data + sizeof(header);
+    map.size = header.size;
+    map.hasIndirectJump = header.hasIndirectJump;
+    map.byteMap.assign(p, p + header.size);
+    map.blocks.clear();
+    p += header.size;
+
+    const u_char *successors = p + size_t(header.blockCount) * sizeof(CacheBlock);
+    u_int32_t successorsLeft = header.successorCount;
+    for (u_int32_t i = 0; i < header.blockCount; i++) {
+        CacheBlock entry;
+        memcpy(&entry, p + i * sizeof(CacheBlock), sizeof(entry));
+        if (entry.successorCount > successorsLeft) return false;
+
+        BasicBlock block;
+        block.start = entry.start;
+        block.end = entry.end;
+        block.isSubroutine = entry.isSubroutine;
+        block.successors.resize(entry.successorCount);
+        memcpy(block.successors.data(), successors, entry.successorCount * sizeof(u_int16_t));
+        successors += entry.successorCount * sizeof(u_int16_t);
+        successorsLeft -= entry.successorCount;
+
+        char label[16];
+        snprintf(label, sizeof(label), "%s%X", block.isSubroutine ? "sub_" : "loc_", block.start);
+        block.label = label;
+
+        map.blocks.emplace_hint(map.blocks.end(), block.start, std::move(block));
+    }
+    return true;
+}
+
+/**
+ * Loads a ROM's Analysis from the Cache
+ *
+ * @param romHash - Hash::hash64 of the ROM's Bytes
+ * @param map - Filled with the Analysis on a Hit
+ * @returns True on Cache Hit
+ */
+bool AnalysisCache::load(uint64_t romHash, ProgramMap &map) const {
+    string path = entryPath(romHash);
+
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    bool isHit = parseEntry(static_cast<const u_char *>(data), info.st_size, romHash, map);
+    munmap(data, info.st_size);
+    return isHit;
+#else
+    ifstream file(path, ios::binary);
+    if (!file) return false;
+    vector<u_char> data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    return parseEntry(data.data(), data.size(), romHash, map);
+#endif
+}
+
+/**
+ * Stores a ROM's Analysis in the Cache, Written to a Temporary
+ *  File then Renamed so Concurrent Readers never see Half an Entry
+ *
+ * @param romHash - Hash::hash64 of the ROM's Bytes
+ * @param map - Analysis to Store
+ * @returns True if Written
+ */
+bool AnalysisCache::store(uint64_t romHash, const ProgramMap &map) const {
+    CacheHeader header;
+    memset(&header, 0x0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = ANALYSIS_CACHE_VERSION;
+    header.size = map.size;
+    header.romHash = romHash;
+    header.blockCount = u_int32_t(map.blocks.size());
+    header.hasIndirectJump = map.hasIndirectJump;
+
+    vector<CacheBlock> blocks;
+    vector<u_int16_t> successors;
+    for (const auto &entry : map.blocks) {
+        const BasicBlock &block = entry.second;
+        CacheBlock cached;
+        memset(&cached, 0x0, sizeof(cached));
+        cached.start = block.start;
+        cached.end = block.end;
+        cached.successorCount = u_int16_t(block.successors.size());
+        cached.isSubroutine = block.isSubroutine;
+        blocks.push_back(cached);
+        successors.insert(successors.end(), block.successors.begin(), block.successors.end());
+    }
+    header.successorCount = u_int32_t(successors.size());
+
+    error_code err;
+    fs::create_directories(dir, err);
+    if (err) return false;
+
+    string path = entryPath(romHash);
+    string tempPath = path + ".tmp" + to_string(chrono::steady_clock::now().time_since_epoch().count());
+    {
+        ofstream file(tempPath, ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(map.byteMap.data()), map.byteMap.size());
+        file.write(reinterpret_cast<const char *>(blocks.data()), blocks.size() * sizeof(CacheBlock));
+        file.write(reinterpret_cast<const char *>(successors.data()), successors.size() * sizeof(u_int16_t));
+        if (!file) {
+            file.close();
+            fs::remove(tempPath, err);
+            return false;
+        }
+    }
+
+    fs::rename(tempPath, path, err);
+    if (!err) return true;
+
+    fs::remove(tempPath, err);
+    return false;
+}
+
+/**
+ * Returns the ROM's Analysis, from the Cache if it's been
+ *  Analyzed before, otherwise Analyzing and Storing it
+ *
+ * @param rom - ROM's Bytes
+ * @param size - Size of the ROM in Bytes
+ */
+ProgramMap AnalysisCache::analyze(const u_char *rom, u_int16_t size) {
+    uint64_t romHash = Hash::hash64(rom, size);
+
+    ProgramMap map;
+    if (load(romHash, map))
+        return map;
+
+    Disassembler dasm;
+    map = dasm.analyze(rom, size);
+    store(romHash, map);
+    return map;
+}
@@ -0,0 +1,156 @@
+#include "../include/Audio.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+
+#define AUDIO_GAIN_MAX 0x100  // Full Volume Gain (8 Bit Fraction)
+#define AUDIO_GAIN_STEP 0x8   // Gain Change per Sample (~0.7ms Ramp at 48kHz)
+
+
+/**
+ * Precomputes the Buzzer's Waveform, Device is
+ *  Opened Separately once SDL is Initialized
+ */
+Audio::Audio()
+    : device(0), frequency(AUDIO_SAMPLE_RATE), onFrame(nullptr), frameUserdata(nullptr), frameClock(0),
+      soundTimer(0), phase(0), gain(0), patternHigh(0), patternLow(0), patternStep(0), patternPhase(0) {
+    // Square Wave, one Period over the Table
+    for (int i = 0; i < AUDIO_TABLE_SIZE; i++)
+        waveTable[i] = i < AUDIO_TABLE_SIZE / 2 ? AUDIO_VOLUME : -AUDIO_VOLUME;
+
+    // Phase is a 32 Bit Fraction of a Period
+    phaseStep = u_int32_t((uint64_t(AUDIO_TONE) << 32) / AUDIO_SAMPLE_RATE);
+}
+
+Audio::~Audio() {
+    close();
+}
+
+/**
+ * Makes the Device the Emulation's Clock, onFrame Runs on
+ *  the Audio Thread once per 1/60s of Samples, right before
+ *  they're Generated so the Buzzer Matches the Frame
+ *
+ * @param callback - Runs one Frame, NULL to Stop Clocking
+ * @param userdata - Passed to the Callback
+ */
+void Audio::setFrameCallback(AudioFrameCallback callback, void *userdata) {
+    onFrame = callback;
+    frameUserdata = userdata;
+}
+
+/**
+ * Publishes an XO-CHIP Audio Pattern, Played in place of the
+ *  Waveform from then on. Lock-Free like setSoundTimer, the
+ *  Audio Thread may mix an old and new Half for one Buffer
+ *
+ * @param pattern - 128 1-bit Samples (CHIP8State::pattern)
+ * @param pitch - Playback Rate is 4000 * 2^((pitch - 64) / 48) Samples per Second
+ */
+void Audio::setPattern(const u_char pattern[16], u_char pitch) {
+    uint64_t high = 0x0, low = 0x0;
+    for (int i = 0; i < 8; i++) {
+        high = (high << 8) | pattern[i];
+        low = (low << 8) | pattern[i + 8];
+    }
+    patternHigh.store(high, std::memory_order_relaxed);
+    patternLow.store(low, std::memory_order_relaxed);
+
+    // Phase is a 32 Bit Fraction of the 128 Samples, 2^25 per Sample
+    double rate = AUDIO_PATTERN_RATE * std::pow(2.0, (pitch - 64) / 48.0);
+    patternStep.store(u_int32_t(rate * double(1 << 25) / frequency), std::memory_order_relaxed);
+}
+
+/**
+ * Opens the Default Audio Device, Small Buffers keep
+ *  Sound Timer to Speaker Latency under a Frame
+ *
+ * @returns False if there's no Usable Device (Runs Silent)
+ */
+bool Audio::open() {
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        spdlog::warn("Audio::open: SDL Audio Init Failed ({}), Running Silent", SDL_GetError());
+        return false;
+    }
+
+    SDL_AudioSpec want, have;
+    SDL_zero(want);
+    want.freq = AUDIO_SAMPLE_RATE;
+    want.format = AUDIO_S16SYS;
+    want.channels = 1;
+    want.samples = AUDIO_BUFFER_SIZE;
+    want.callback = callback;
+    want.userdata = this;
+
+    device = SDL_OpenAudioDevice(nullptr, 0, &want, &have, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+    if (device == 0) {
+        spdlog::warn("Audio::open: No Audio Device ({}), Running Silent", SDL_GetError());
+        return false;
+    }
+
+    // Device may run at it's own Rate
+    frequency = have.freq;
+    phaseStep = u_int32_t((uint64_t(AUDIO_TONE) << 32) / frequency);
+
+    SDL_PauseAudioDevice(device, 0);
+    return true;
+}
+
+/**
+ * Stops and Closes the Audio Device
+ */
+void Audio::close() {
+    if (device == 0) return;
+    SDL_CloseAudioDevice(device);
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    device = 0;
+}
+
+/**
+ * SDL Audio Thread, Fills the Buffer from the Waveform
+ *  Table while the Sound Timer is Non-Zero, Ramping the
+ *  Gain at the Edges. When Clocking Emulation, Frames Run
+ *  at their Sample within the Buffer
+ *
+ * @param userdata - Audio Instance
+ * @param stream - Buffer to Fill
+ * @param len - Buffer Size in Bytes
+ */
+void Audio::callback(void *userdata, Uint8 *stream, int len) {
+    Audio *audio = static_cast<Audio *>(userdata);
+    int16_t *samples = reinterpret_cast<int16_t *>(stream);
+    int count = len / int(sizeof(int16_t));
+
+    int32_t target = audio->soundTimer.load(std::memory_order_relaxed) ? AUDIO_GAIN_MAX : 0x0;
+    u_int32_t patternStep = audio->patternStep.load(std::memory_order_relaxed);
+    uint64_t patternHigh = audio->patternHigh.load(std::memory_order_relaxed);
+    uint64_t patternLow = audio->patternLow.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; i++) {
+        if (audio->onFrame) {
+            audio->frameClock += AUDIO_FRAME_RATE;
+            if (audio->frameClock >= audio->frequency) {
+                audio->frameClock -= audio->frequency;
+                audio->onFrame(audio->frameUserdata);
+                target = audio->soundTimer.load(std::memory_order_relaxed) ? AUDIO_GAIN_MAX : 0x0;
+            }
+        }
+
+        if (audio->gain < target) audio->gain += AUDIO_GAIN_STEP;
+        else if (audio->gain > target) audio->gain -= AUDIO_GAIN_STEP;
+
+        // XO-CHIP Pattern once one's Published, Otherwise the Buzzer's Waveform
+        int32_t wave;
+        if (patternStep) {
+            u_int32_t index = audio->patternPhase >> 25;
+            uint64_t half = index < 64 ? patternHigh : patternLow;
+            wave = ((half >> (63 - (index & 0x3F))) & 0x1) ? AUDIO_VOLUME : -AUDIO_VOLUME;
+            audio->patternPhase += patternStep;
+        } else {
+            wave = audio->waveTable[audio->phase >> 24];
+            audio->phase += audio->phaseStep;
+        }
+
+        samples[i] = int16_t((wave * audio->gain) >> 8);
+    }
+}
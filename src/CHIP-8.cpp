@@ -2,11 +2,20 @@
 // Created by chad on 3/3/20.
 //
 #include "../include/CHIP-8.h"
+#include "../include/CloneArena.h"
+#include "../include/Disassembler.h"
+#include "../include/Hash.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
 
 /**
  * Constructs CHIP8 to Default
  */
 CHIP8::CHIP8() {
+    this->mode = MODE_CHIP8;
     this->init();
     this->out = nullptr;
 }
@@ -15,34 +24,113 @@ CHIP8::CHIP8() {
  * CHIP8 Constructor with Ofstream Defined
  */
 CHIP8::CHIP8(std::ostream* out) {
+    this->mode = MODE_CHIP8;
     this->out = out;
     this->init();
 }
 
+/**
+ * Copies another CHIP8, Memory Pointer is
+ *  Pointed at the Copy's own Memory
+ */
+CHIP8::CHIP8(const CHIP8& other) {
+    *this = other;
+}
+
+/**
+ * Copies another CHIP8's Entire Machine
+ */
+CHIP8& CHIP8::operator=(const CHIP8& other) {
+    state = other.state;
+    bootImage = other.bootImage;
+    mode = other.mode;
+    memoryMask = other.memoryMask;
+    xoMemory = other.xoMemory;
+    xoBootMemory = other.xoBootMemory;
+    memory = mode == MODE_XO_CHIP ? xoMemory.data() : state.memory;
+    out = other.out;
+    memcpy(decodeCache, other.decodeCache, sizeof(decodeCache));
+    dirtyPages = other.dirtyPages;
+    compiled = other.compiled;
+    keyProvider = other.keyProvider;
+    keyUserdata = other.keyUserdata;
+    keyReadTime = other.keyReadTime;
+    keyObserver = other.keyObserver;
+    observerUserdata = other.observerUserdata;
+    memcpy(key, other.key, sizeof(key));
+    drawFlag = other.drawFlag;
+    soundFlag = other.soundFlag;
+    return *this;
+}
+
+/**
+ * Picks the Machine to Run as, Clearing it back to
+ *  a Freshly Constructed State. XO-CHIP's 64KB Memory is
+ *  Allocated only here, CHIP-8 keeps it's 4KB in the State
+ * 
+ * @param newMode - MODE_CHIP8 or MODE_XO_CHIP
+ */
+void CHIP8::setMode(Mode newMode) {
+    mode = newMode;
+    init();
+}
+
+/**
+ * Returns the Machine Running
+ */
+Mode CHIP8::getMode() const {
+    return mode;
+}
+
 /**
  * Initiates CHIP8's Data
  */
 void CHIP8::init() {
-    srand(time(NULL));  // Initialize Random Seed
-    PC = 0x200;         // Set PC to ROM Starting Address in Memory
-
-    // Zero Everything
-    memset(V, 0x0, 0xF);
-    I = 0x0;
-    dTimer = 0x0;
-    sTimer = 0x0;
+    // Zero Everything (Registers, Stack, Display, and Memory)
+    memset(&state, 0x0, sizeof(state));
+    state.PC = 0x200;   // Set PC to ROM Starting Address in Memory
+    state.planes = 0x1; // Draw on Plane 1 (XO-CHIP)
+    state.pitch = 64;   // 4000 Samples per Second (XO-CHIP)
     drawFlag = false;
+    soundFlag = false;
+
+    // XO-CHIP Memory is Outside the State, Sized only in it's Mode
+    if (mode == MODE_XO_CHIP) {
+        xoMemory.assign(XO_MEMORY_SIZE, 0x0);
+        memory = xoMemory.data();
+        memoryMask = XO_MEMORY_SIZE - 1;
+    } else {
+        std::vector<u_char>().swap(xoMemory);
+        memory = state.memory;
+        memoryMask = MEMORY_SIZE - 1;
+    }
 
-    // Clear Screen
-    CLS();
+    // Initialize Random Seed
+    seed(time(NULL));
 
-    // Load in Font Set
+    // Load in Font Sets
     for (u_char i = 0; i < 0x50; i++)
         memory[i] = fontSet[i];
+    for (u_char i = 0; i < 0xA0; i++)
+        memory[BIG_FONT_START + i] = bigFontSet[i];
 
-    // Clear Keys
+    // Clear Keys, Set Directly until a Provider is Given
     for (u_char& k : key)
         k = false;
+    keyProvider = nullptr;
+    keyUserdata = nullptr;
+    keyReadTime = 0;
+    keyObserver = nullptr;
+    observerUserdata = nullptr;
+
+    // Nothing Decoded Yet
+    memset(decodeCache, 0x0, sizeof(decodeCache));
+
+    // Nothing Loaded, Boot into Empty Memory
+    bootImage = state;
+    xoBootMemory = xoMemory;
+    dirtyPages = 0x0;
+    compiled = nullptr;
 }
 
 /**
@@ -51,24 +139,361 @@ void CHIP8::init() {
  * @param romPath - File Path to ROM
  */
 void CHIP8::loadROM(char* romPath) {
-    std::stringstream hexStream;
+    std::vector<u_char> rom;
     Disassembler dasm;
-    dasm.hexDump(romPath, hexStream);
+    if (dasm.readROM(romPath, rom))
+        loadROM(rom.data(), std::min<size_t>(rom.size(), getMemSize() - 0x200));
+}
+
+/**
+ * Loads given ROM Buffer into Memory starting at
+ *  address 0x200
+ * @param rom - ROM's Bytes
+ * @param size - Size of the ROM in Bytes
+ * @returns False if the ROM doesn't fit in Memory
+ */
+bool CHIP8::loadROM(const u_char* rom, size_t size) {
+    if (size > getMemSize() - 0x200)
+        return false;
 
-    u_int16_t h;
     // Store ROM in RAM starting at 0x200
-    for (int addr = 0x200; hexStream >> h; addr++) {
-        this->memory[addr] = h;
+    for (size_t i = 0; i < size; i++) {
+        int addr = 0x200 + i;
+        memory[addr] = rom[i];
 
 #if CHIP8_DEBUG  // DEBUG: RAM Storage Verbose
         std::cout << std::hex << std::setw(2) << std::setfill('0')
                   << "RAM[0x" << std::uppercase << addr << "]:"
                   << std::setw(2) << std::setfill('0')
-                  << short(this->memory[addr])
+                  << short(memory[addr])
                   << std::resetiosflags(std::ios::hex | std::ios::uppercase) << "  ";
         if (!((addr + 1) % 8)) std::cout << '\n';
 #endif
     }
+
+    // Memory Changed, Previous Decodes are Stale
+    memset(decodeCache, 0x0, sizeof(decodeCache));
+
+    // Save Boot Image for reset
+    bootImage = state;
+    xoBootMemory = xoMemory;
+    dirtyPages = 0x0;
+
+    // Translation was of a Different ROM
+    compiled = nullptr;
+    return true;
+}
+
+/**
+ * Attaches a ROM Translated Ahead of Time, used by step
+ *  while Execution stays in Translated Code
+ * 
+ * @param rom - Translation, NULL to Detach
+ * @returns False if the Translation is not of the Loaded ROM (or Machine is XO-CHIP)
+ */
+bool CHIP8::attach(const CompiledROM* rom) {
+    if (rom && (mode != MODE_CHIP8 || rom->romSize > sizeof(bootImage.memory) - ROM_START ||
+                Hash::hash64(bootImage.memory + ROM_START, rom->romSize) != rom->romHash))
+        return false;
+
+    compiled = rom;
+    return true;
+}
+
+/**
+ * Latches the Keys Late, the Provider is Asked for the Keys
+ *  Held Right Now each time EX9E, EXA1, or FX0A Runs instead
+ *  of whenever key was Last Written. Each Read is Timestamped
+ * 
+ * @param provider - Returns the Current Key Mask, NULL to Read key as Set
+ * @param userdata - Passed to the Provider
+ */
+void CHIP8::setKeyProvider(KeyProvider provider, void* userdata) {
+    keyProvider = provider;
+    keyUserdata = userdata;
+}
+
+/**
+ * Watches Key Reads without Changing how Keys are Set, the
+ *  Observer is Told the Keys each time EX9E, EXA1, or FX0A
+ *  Runs (Input Latency Stamps the Read this way)
+ * 
+ * @param observer - Told the Keys Read, NULL Stops
+ * @param userdata - Passed to the Observer
+ */
+void CHIP8::setKeyObserver(KeyObserver observer, void* userdata) {
+    keyObserver = observer;
+    observerUserdata = userdata;
+}
+
+/**
+ * Returns when the Keys were Last Latched from the Provider
+ *  in steady_clock Nanoseconds, 0 if they never were
+ */
+uint64_t CHIP8::getKeyReadTime() const {
+    return keyReadTime;
+}
+
+/**
+ * Refreshes all 16 Keys from the Provider's Mask if there's
+ *  a Provider, then Tells the Observer the Keys being Read
+ */
+void CHIP8::latchKeys() {
+    u_int16_t mask = 0x0;
+    if (keyProvider) {
+        mask = keyProvider(keyUserdata);
+        for (u_char i = 0x0; i <= 0xF; i++)
+            key[i] = (mask >> i) & 0x1;
+        keyReadTime = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    } else {
+        for (u_char i = 0x0; i <= 0xF; i++)
+            mask |= u_int16_t(key[i] ? 0x1 << i : 0x0);
+    }
+
+    if (keyObserver) keyObserver(mask, observerUserdata);
+}
+
+/**
+ * Seeds the Random Generator used by CXKK
+ *  Same Seed gives the same Sequence on every Instance,
+ *  and the Seed is Restored on reset
+ * 
+ * @param value - Seed, any Value (0 Included)
+ */
+void CHIP8::seed(uint64_t value) {
+    // Scramble Seed (SplitMix64) so Nearby Seeds give Unrelated Sequences
+    uint64_t z = value + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+
+    state.rng = z ? z : 0x1;  // xorshift State can't be 0
+    bootImage.rng = state.rng;
+}
+
+/**
+ * Restores the Machine to the State it was in right after
+ *  the ROM was Loaded, without Re-Reading the ROM.
+ *  Only Decodes in Memory Pages Written since then are Dropped
+ */
+void CHIP8::reset() {
+    state = bootImage;
+    if (mode == MODE_XO_CHIP)
+        memcpy(xoMemory.data(), xoBootMemory.data(), XO_MEMORY_SIZE);
+    drawFlag = false;
+    soundFlag = false;
+
+    // Drop Decodes of Self-Modified Code
+    for (int page = 0; dirtyPages; page++, dirtyPages >>= 1) {
+        if (!(dirtyPages & 0x1)) continue;
+        for (int i = 0; i < DIRTY_PAGE_SIZE; i++)
+            decodeCache[page * DIRTY_PAGE_SIZE + i].op = OP_UNDECODED;
+    }
+}
+
+/**
+ * Decodes every Instruction the Analysis found
+ *  into the Decode Cache, so running the ROM
+ *  doesn't have to Decode on first Visit
+ * 
+ * @param map - Control Flow Analysis of the Loaded ROM
+ */
+void CHIP8::prewarm(const ProgramMap& map) {
+    for (u_int16_t addr = ROM_START; addr < ROM_START + map.size && addr < MEMORY_SIZE; addr++) {
+        if (map.isCode(addr))
+            decodeCache[addr] = decodeAt(addr);
+    }
+}
+
+/**
+ * Decodes the Instruction at the given Address for the
+ *  Decode Cache, Fusing it with the Instruction after it
+ *  when the Pair is one of the Fused Operations
+ * 
+ * @param addr - Address of the Instruction
+ */
+Instruction CHIP8::decodeAt(u_int16_t addr) {
+    u_int16_t opcode = (memory[addr & memoryMask] << 8) | memory[(addr + 1) & memoryMask];
+    u_int16_t next = (memory[(addr + 2) & memoryMask] << 8) | memory[(addr + 3) & memoryMask];
+
+    Instruction ins = fuse(opcode, next);
+    if (ins.op != OP_UNDECODED)
+        return ins;
+
+    // Skip Storing VF when the Next Instruction Overwrites it anyway
+    ins = decode(opcode, mode);
+    if (ins.x != 0xF && ins.y != 0xF && overwritesVF(decode(next, mode))) {
+        switch (ins.op) {
+        case OP_ADD_REG:    ins.op = OP_ADD_REG_NF; break;
+        case OP_SUB:        ins.op = OP_SUB_NF; break;
+        case OP_SHR:        ins.op = OP_SHR_NF; break;
+        case OP_SUBN:       ins.op = OP_SUBN_NF; break;
+        case OP_SHL:        ins.op = OP_SHL_NF; break;
+        default:            break;
+        }
+    }
+    return ins;
+}
+
+/**
+ * Checks if an Instruction always Writes VF without
+ *  Reading it first, making any Flag Stored before it Dead
+ * 
+ * @param ins - Unfused Instruction
+ */
+bool CHIP8::overwritesVF(const Instruction& ins) {
+    switch (ins.op) {
+    case OP_ADD_REG:
+    case OP_SUB:
+    case OP_SHR:
+    case OP_SUBN:
+    case OP_SHL:
+    case OP_DRW:        return ins.x != 0xF && ins.y != 0xF;
+    case OP_LD_REG:     return ins.x == 0xF && ins.y != 0xF;
+    case OP_LD_BYTE:
+    case OP_RND:
+    case OP_LD_VX_DT:
+    case OP_LD_VX_MEM:  return ins.x == 0xF;
+    default:            return false;
+    }
+}
+
+/**
+ * Fuses 2 Sequential Opcodes into a Single Instruction.
+ *  Pairs were Picked from the most Frequent Pairs Executed
+ *  across the ROM Corpus. The Operation says both High
+ *  Nibbles, so x, y, and n hold the Low 12 Bits of each:
+ *  x = XY of the First, y = N of the First and X of the
+ *  Second, n = YN of the Second
+ * 
+ * @param first - Opcode Run First
+ * @param second - Opcode at the Following Address
+ * @returns OP_UNDECODED Instruction if the Pair doesn't Fuse
+ */
+Instruction CHIP8::fuse(u_int16_t first, u_int16_t second) {
+    Instruction ins;
+    ins.op = OP_UNDECODED;
+    ins.x = (first & 0x0FF0) >> 4;
+    ins.y = ((first & 0x000F) << 4) | ((second & 0x0F00) >> 8);
+    ins.n = second & 0x00FF;
+
+    switch (((first & 0xF000) >> 8) | ((second & 0xF000) >> 12)) {
+    case 0x31: ins.op = OP_SE_JP; break;
+    case 0x41: ins.op = OP_SNE_JP; break;
+    case 0x66: ins.op = OP_LD_LD; break;
+    case 0x6E: if ((second & 0xFF) == 0xA1) ins.op = OP_LD_SKNP; break;
+    case 0x73: ins.op = OP_ADD_SE; break;
+    case 0xAF: if ((second & 0xFF) == 0x1E) ins.op = OP_LD_I_ADD_I; break;
+    case 0xAD: ins.op = OP_LD_I_DRW; break;
+    default:   break;
+    }
+    return ins;
+}
+
+/**
+ * Decodes the Opcode into it's Operation and Nibbles
+ *  Matches the Dispatch done in CHIP8::run. XO-CHIP's
+ *  Opcodes (5XY2, 5XY3, F000 NNNN, FN01, F002, FX3A)
+ *  are NOPs in CHIP-8 Mode, F000 is then 2 Bytes as
+ *  skip Assumes
+ * 
+ * @param opcode - 2 Byte Opcode
+ * @param mode - Machine the Opcode Runs on
+ */
+Instruction CHIP8::decode(u_int16_t opcode, Mode mode) {
+    bool isXO = mode == MODE_XO_CHIP;
+    Instruction ins;
+    ins.op = OP_NOP;
+    ins.x = (opcode & 0x0F00) >> 8;
+    ins.y = (opcode & 0x00F0) >> 4;
+    ins.n = opcode & 0x000F;
+
+    switch (opcode & 0xF000) {
+    case 0x0000:
+        if ((opcode & 0xFFF) == 0x0E0) ins.op = OP_CLS;
+        else if ((opcode & 0xFFF) == 0x0EE) ins.op = OP_RET;
+        else if ((opcode & 0xFFF0) == 0x00C0) ins.op = OP_SCD;
+        else if ((opcode & 0xFFF0) == 0x00D0) ins.op = OP_SCU;
+        else if ((opcode & 0xFFF) == 0x0FB) ins.op = OP_SCR;
+        else if ((opcode & 0xFFF) == 0x0FC) ins.op = OP_SCL;
+        else if ((opcode & 0xFFF) == 0x0FD) ins.op = OP_EXIT;
+        else if ((opcode & 0xFFF) == 0x0FE) ins.op = OP_LOW;
+        else if ((opcode & 0xFFF) == 0x0FF) ins.op = OP_HIGH;
+        break;
+    case 0x1000: ins.op = OP_JP; break;
+    case 0x2000: ins.op = OP_CALL; break;
+    case 0x3000: ins.op = OP_SE_BYTE; break;
+    case 0x4000: ins.op = OP_SNE_BYTE; break;
+    case 0x5000:
+        if (ins.n == 0x2 || ins.n == 0x3) {
+            if (isXO) ins.op = ins.n == 0x2 ? OP_LD_MEM_RANGE : OP_LD_RANGE_MEM;
+        } else {
+            ins.op = OP_SE_REG;
+        }
+        break;
+    case 0x6000: ins.op = OP_LD_BYTE; break;
+    case 0x7000: ins.op = OP_ADD_BYTE; break;
+    case 0x8000:
+        switch (ins.n) {
+        case 0x0: ins.op = OP_LD_REG; break;
+        case 0x1: ins.op = OP_OR; break;
+        case 0x2: ins.op = OP_AND; break;
+        case 0x3: ins.op = OP_XOR; break;
+        case 0x4: ins.op = OP_ADD_REG; break;
+        case 0x5: ins.op = OP_SUB; break;
+        case 0x6: ins.op = OP_SHR; break;
+        case 0x7: ins.op = OP_SUBN; break;
+        case 0xE: ins.op = OP_SHL; break;
+        }
+        break;
+    case 0x9000: ins.op = OP_SNE_REG; break;
+    case 0xA000: ins.op = OP_LD_I; break;
+    case 0xB000: ins.op = OP_JP_V0; break;
+    case 0xC000: ins.op = OP_RND; break;
+    case 0xD000: ins.op = OP_DRW; break;
+    case 0xE000: ins.op = (opcode & 0xFF) == 0x9E ? OP_SKP : OP_SKNP; break;
+    case 0xF000:
+        switch (opcode & 0xFF) {
+        case 0x00: if (isXO && ins.x == 0x0) ins.op = OP_LD_I_LONG; break;
+        case 0x01: if (isXO) ins.op = OP_PLANE; break;
+        case 0x02: if (isXO && ins.x == 0x0) ins.op = OP_LD_PATTERN; break;
+        case 0x07: ins.op = OP_LD_VX_DT; break;
+        case 0x0A: ins.op = OP_LD_VX_K; break;
+        case 0x15: ins.op = OP_LD_DT; break;
+        case 0x18: ins.op = OP_LD_ST; break;
+        case 0x1E: ins.op = OP_ADD_I; break;
+        case 0x29: ins.op = OP_LD_F; break;
+        case 0x30: ins.op = OP_LD_HF; break;
+        case 0x33: ins.op = OP_LD_B; break;
+        case 0x3A: if (isXO) ins.op = OP_LD_PITCH; break;
+        case 0x55: ins.op = OP_LD_MEM_VX; break;
+        case 0x65: ins.op = OP_LD_VX_MEM; break;
+        case 0x75: ins.op = OP_LD_R_VX; break;
+        case 0x85: ins.op = OP_LD_VX_R; break;
+        }
+        break;
+    }
+
+    return ins;
+}
+
+/**
+ * Drops the Decoded Instructions that cover the
+ *  given Address, since it's Memory was Written to
+ * 
+ * @param addr - Written Address
+ */
+void CHIP8::invalidate(u_int16_t addr) {
+    // Fused Entries cover 4 Bytes, so up to 3 Addresses back
+    for (u_int16_t back = 0x0; back <= 0x3; back++) {
+        u_int16_t at = (addr - back) & memoryMask;
+        if (at >= MEMORY_SIZE) continue;  // XO-CHIP's Upper Memory isn't Decode Cached
+        decodeCache[at].op = OP_UNDECODED;
+
+        // Page Differs from the Boot Image now
+        dirtyPages |= 1ULL << (at / DIRTY_PAGE_SIZE);
+    }
 }
 
 /**
@@ -80,11 +505,11 @@ void CHIP8::loadROM(char* romPath) {
  */
 void CHIP8::memDump(std::ostream& out) {
     // Output 2 Bytes Per Line
-    for (int i = 0x0; i < 0xFFF; i += 0x2) {
+    for (size_t i = 0x0; i < getMemSize() - 1; i += 0x2) {
         out << "[0x" << std::setw(4) << std::setfill('0') << std::uppercase << std::hex
             << i << "] " << std::hex << std::setw(2) << std::setfill('0')
-            << short(this->memory[i]) << ' ' << std::setw(2) << std::setfill('0')
-            << short(this->memory[i + 1])
+            << short(memory[i]) << ' ' << std::setw(2) << std::setfill('0')
+            << short(memory[i + 1])
             << std::resetiosflags(std::ios::hex | std::ios::uppercase) << '\n';
     }
 }
@@ -99,7 +524,7 @@ void CHIP8::regDump(std::ostream& out) {
     for (u_char i = 0x0; i <= 0xF; i++) {
         out << "V" << short(i) << " = 0x"
             << std::uppercase << std::hex << std::setw(2) << std::setfill('0')
-            << short(V[i]) << '\t';
+            << short(state.V[i]) << '\t';
 
         if (!((i + 1) % 4)) out << '\n';
     }
@@ -108,19 +533,19 @@ void CHIP8::regDump(std::ostream& out) {
     out << "========= Timers ========\n";
     out << "I = 0x"
         << std::uppercase << std::hex << std::setw(4) << std::setfill('0')
-        << short(I) << '\t';
+        << short(state.I) << '\t';
     out << "PC = 0x"
         << std::uppercase << std::hex << std::setw(4) << std::setfill('0')
-        << short(PC) << '\t';
+        << short(state.PC) << '\t';
 
 
     out << "dT = 0x"
         << std::uppercase << std::hex << std::setw(2) << std::setfill('0')
-        << short(dTimer) << '\t';
+        << short(state.dTimer) << '\t';
 
     out << "sT = 0x"
         << std::uppercase << std::hex << std::setw(2) << std::setfill('0')
-        << short(sTimer) << '\t';
+        << short(state.sTimer) << '\t';
 
     out << std::endl;
 }
@@ -134,27 +559,15 @@ void CHIP8::stackDump(std::ostream& out) {
     out << "======== Stack ========\n";
 
     // Check if Emtpy
-    if (stack.empty()) {
+    if (state.SP == 0) {
         out << "Stack = EMPTY\n";
         return;
     }
 
-    // Save Stack
-    std::stack<u_int16_t> bStack;
-
-    // Output Entire Stack while backing up to bStack
-    out << "Stack.size = " << stack.size() << '\n';
-    for (int i = 0; stack.size() > 0; i++) {
-        out << "Stack[" << i << "] = " << stack.top() << '\n';
-        bStack.push(stack.top());
-        stack.pop();
-    }
-
-    // Restore Stack
-    for (int i = 0; bStack.size() > 0; i++) {
-        stack.push(bStack.top());
-        bStack.pop();
-    }
+    // Output Entire Stack from the Top down
+    out << "Stack.size = " << short(state.SP) << '\n';
+    for (int i = 0; i < state.SP; i++)
+        out << "Stack[" << i << "] = " << state.stack[state.SP - 1 - i] << '\n';
 }
 
 /**
@@ -178,9 +591,11 @@ void CHIP8::keyDump(std::ostream& out) {
  * @param out - Stream to output Display to
  */
 void CHIP8::displayDump(std::ostream& out) {
-    for (u_char y = 0; y < 32; y++) {
-        for (u_char x = 0; x < 64; x++) {
-            out << (display[x][y] ? "▓" : "░");
+    u_char width = state.hires ? DISPLAY_HIRES_WIDTH : DISPLAY_WIDTH;
+    u_char height = state.hires ? DISPLAY_HIRES_HEIGHT : DISPLAY_HEIGHT;
+    for (u_char y = 0; y < height; y++) {
+        for (u_char x = 0; x < width; x++) {
+            out << (getPixel(x, y) ? "▓" : "░");
         }
         out << '\n';
     }
@@ -193,7 +608,7 @@ void CHIP8::displayDump(std::ostream& out) {
  */
 u_char CHIP8::getRegisterVal(u_char index) const {
     if (index >= 0x0 && index <= 0xF)  // Verify within Bounds
-        return V[index];
+        return state.V[index];
     return 0;
 }
 
@@ -203,38 +618,358 @@ u_char CHIP8::getRegisterVal(u_char index) const {
  * @param addr - The Address in Memory
  */
 u_char CHIP8::getMemVal(u_int16_t addr) const {
-    if (addr < 0xFFF && addr >= 0x000) // Make sure within Bounds
+    if (addr < getMemSize()) // Make sure within Bounds
         return memory[addr];
     else
         return 0x00;
 }
 
+/**
+ * Returns the Size of the Active Memory
+ *  4KB, or 64KB in XO-CHIP Mode
+ */
+size_t CHIP8::getMemSize() const {
+    return size_t(memoryMask) + 1;
+}
+
+/**
+ * Returns the Active Memory, state.memory or
+ *  XO-CHIP's 64KB (getMemSize Bytes)
+ */
+const u_char* CHIP8::getMemory() const {
+    return memory;
+}
+
 /**
  * Returns the Current Delay Timer
  */
 u_char CHIP8::get_dTimer() const {
-    return dTimer;
+    return state.dTimer;
 }
 
 /**
  * Returns the Current Sound Timer
  */
 u_char CHIP8::get_sTimer() const {
-    return sTimer;
+    return state.sTimer;
+}
+
+/**
+ * Timers Count down per Instruction, so a Short Tone (FX18
+ *  with 2-4) can Run Out inside the Frame that Set it. The
+ *  Buzzer Sounds for the Frame if the Timer was Set at all
+ */
+bool CHIP8::isSoundOn() const {
+    return state.sTimer || soundFlag;
 }
 
 /**
  * Returns the Current Index Register Value
  */
 u_int16_t CHIP8::getIndexReg() const {
-    return I;
+    return state.I;
 }
 
 /**
  * Returns the Current Program Counter Value
  */
 u_int16_t CHIP8::getProgramCounter() const {
-    return PC;
+    return state.PC;
+}
+
+/**
+ * Returns the Pixel at the given Display Position
+ * 
+ * @param x - X-Coord (0 - 63, 0 - 127 in Hires)
+ * @param y - Y-Coord (0 - 31, 0 - 63 in Hires)
+ * @returns Color Index (Plane 1 Bit | Plane 2 Bit << 1), 1 if On and 0 if Off
+ *  for CHIP-8 and SUPER-CHIP
+ */
+u_char CHIP8::getPixel(u_char x, u_char y) const {
+    u_char word = 0;
+    if (!state.hires) {
+        y %= DISPLAY_HEIGHT;
+    } else {
+        x %= DISPLAY_HIRES_WIDTH;
+        y %= DISPLAY_HIRES_HEIGHT;
+        word = x / 64;
+    }
+
+    u_char shift = 63 - (x % 64);
+    return ((state.display[0][y][word] >> shift) & 0x1) | (((state.display[1][y][word] >> shift) & 0x1) << 1);
+}
+
+/**
+ * Checks if the Display is in SUPER-CHIP 128x64 Mode
+ */
+bool CHIP8::isHires() const {
+    return state.hires;
+}
+
+// Bit of each Pixel in a 32 Pixel Run, Leftmost Pixel in the High Bit
+static const u_int32_t columnBits[32] = {
+    0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x04000000, 0x02000000, 0x01000000,
+    0x00800000, 0x00400000, 0x00200000, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000,
+    0x00008000, 0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100,
+    0x00000080, 0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001
+};
+
+/**
+ * Expands the Packed Bitplanes into 32-bit Pixels through a Palette
+ *  32 Pixels at a time, each Pixel's Plane Bits turned into all 1s
+ *  or all 0s Masks that Select it's Color, so there's no Table
+ *  Lookup or Branch for the Compiler to Vectorize around
+ * 
+ * @param display - CHIP8State::display
+ * @param hires - 128x64 if True, 64x32 Otherwise
+ * @param palette - Colors Indexed by Plane 1 Bit | Plane 2 Bit << 1
+ * @param pixels - Output, 128x64 or 64x32 Pixels
+ */
+void compositeDisplay(const uint64_t display[DISPLAY_PLANES][DISPLAY_HIRES_HEIGHT][2], bool hires,
+                      const u_int32_t palette[4], u_int32_t* pixels) {
+    const int width = hires ? DISPLAY_HIRES_WIDTH : DISPLAY_WIDTH;
+    const int height = hires ? DISPLAY_HIRES_HEIGHT : DISPLAY_HEIGHT;
+    const u_int32_t off = palette[0], on1 = palette[1], on2 = palette[2], both = palette[3];
+
+    for (int y = 0; y < height; y++) {
+        for (int half = 0; half < width / 32; half++) {
+            // 32 Pixels of each Plane, Leftmost in the High Bit
+            int shift = (half & 0x1) ? 0 : 32;
+            u_int32_t bits1 = u_int32_t(display[0][y][half >> 1] >> shift);
+            u_int32_t bits2 = u_int32_t(display[1][y][half >> 1] >> shift);
+            u_int32_t* out = pixels + y * width + half * 32;
+
+            for (int x = 0; x < 32; x++) {
+                u_int32_t m1 = (bits1 & columnBits[x]) ? ~0x0u : 0x0u;
+                u_int32_t m2 = (bits2 & columnBits[x]) ? ~0x0u : 0x0u;
+                out[x] = (off & ~m1 & ~m2) | (on1 & m1 & ~m2) | (on2 & ~m1 & m2) | (both & m1 & m2);
+            }
+        }
+    }
+}
+
+/**
+ * Returns the Fault that Halted the CPU
+ *  FAULT_NONE if still Running
+ */
+u_char CHIP8::getFault() const {
+    return state.fault;
+}
+
+/**
+ * Returns the Entire Machine State
+ *  (Except Memory in XO-CHIP Mode, it's Outside the State)
+ */
+const CHIP8State& CHIP8::getState() const {
+    return state;
+}
+
+/**
+ * Hashes the Entire Machine State (Registers, Stack, Display,
+ *  and Memory). Cheap enough to take once per Frame, so two Runs
+ *  can be Compared one 64-bit Value per Frame
+ */
+uint64_t CHIP8::hashState() const {
+    uint64_t hash = Hash::hash64(&state, sizeof(state));
+    if (mode == MODE_XO_CHIP)  // Memory is Outside the State
+        hash = Hash::hash64(xoMemory.data(), xoMemory.size(), hash);
+    return hash;
+}
+
+/**
+ * Replaces the Entire Machine State, Dropping all
+ *  Decoded Instructions since Memory may differ.
+ *  XO-CHIP Memory is Outside the State, Kept unless
+ *  a Copy of it is Given
+ * 
+ * @param newState - State to Copy in
+ * @param xoCopy - XO-CHIP's 64KB to Copy in (NULL Keeps it, Ignored in CHIP-8 Mode)
+ */
+void CHIP8::setState(const CHIP8State& newState, const u_char* xoCopy) {
+    state = newState;
+    if (xoCopy && mode == MODE_XO_CHIP)
+        memcpy(xoMemory.data(), xoCopy, XO_MEMORY_SIZE);
+    memset(decodeCache, 0x0, sizeof(decodeCache));
+
+    // Pages that now differ from the Boot Image, and the Page before
+    //  as invalidate Marks it (Fused Entries there Span into the Page)
+    const u_char* boot = mode == MODE_XO_CHIP ? xoBootMemory.data() : bootImage.memory;
+    dirtyPages = 0x0;
+    for (int page = 0; page < MEMORY_SIZE / DIRTY_PAGE_SIZE; page++) {
+        int offset = page * DIRTY_PAGE_SIZE;
+        if (memcmp(memory + offset, boot + offset, DIRTY_PAGE_SIZE))
+            dirtyPages |= (1ULL << page) | (page ? 1ULL << (page - 1) : 0x0);
+    }
+}
+
+/**
+ * Swaps in the State of another Core Running the same ROM,
+ *  as saveState gave it. Memory Pages Unwritten in both are
+ *  Skipped and only Pages that Differ Drop their Decodes, so one
+ *  Core's Decode Cache can Run many States. CHIP-8 Mode only,
+ *  XO-CHIP's Memory is Outside the State
+ * 
+ * @param newState - State to Copy in
+ * @param newDirtyPages - Memory Pages it has Written since Boot
+ */
+void CHIP8::loadState(const CHIP8State& newState, uint64_t newDirtyPages) {
+    memcpy(&state, &newState, offsetof(CHIP8State, memory));
+
+    uint64_t pages = dirtyPages | newDirtyPages;
+    for (int page = 0; pages; page++, pages >>= 1) {
+        if (!(pages & 0x1)) continue;
+
+        u_char* bytes = state.memory + page * DIRTY_PAGE_SIZE;
+        const u_char* loaded = newState.memory + page * DIRTY_PAGE_SIZE;
+        if (memcmp(bytes, loaded, DIRTY_PAGE_SIZE) == 0) continue;
+        memcpy(bytes, loaded, DIRTY_PAGE_SIZE);
+
+        // Fused Entries cover 4 Bytes, so up to 3 Addresses before the Page
+        for (int addr = std::max(0, page * DIRTY_PAGE_SIZE - 3); addr < (page + 1) * DIRTY_PAGE_SIZE; addr++)
+            decodeCache[addr].op = OP_UNDECODED;
+    }
+    dirtyPages = newDirtyPages;
+}
+
+/**
+ * Copies the State out for loadState. Only Memory Pages Written
+ *  since Boot are Copied, so the Copy must already Hold this ROM's
+ *  Boot Image or a State saved from it with no more Pages Written
+ * 
+ * @param copy - State to Copy into
+ * @returns Memory Pages Written since Boot (loadState's newDirtyPages)
+ */
+uint64_t CHIP8::saveState(CHIP8State& copy) const {
+    memcpy(&copy, &state, offsetof(CHIP8State, memory));
+
+    uint64_t pages = dirtyPages;
+    for (int page = 0; pages; page++, pages >>= 1) {
+        if (pages & 0x1)
+            memcpy(copy.memory + page * DIRTY_PAGE_SIZE, state.memory + page * DIRTY_PAGE_SIZE, DIRTY_PAGE_SIZE);
+    }
+    return dirtyPages;
+}
+
+/**
+ * Returns the State right after the ROM was Loaded
+ *  (Memory in XO-CHIP Mode is Outside the State)
+ */
+const CHIP8State& CHIP8::getBootState() const {
+    return bootImage;
+}
+
+/**
+ * Returns Memory right after the ROM was Loaded,
+ *  all 64KB of it in XO-CHIP Mode
+ */
+const u_char* CHIP8::getBootMemory() const {
+    return mode == MODE_XO_CHIP ? xoBootMemory.data() : bootImage.memory;
+}
+
+/**
+ * Copies the State into the Arena for Tree Search. Only the
+ *  Registers are always Copied, Display and Memory Pages are
+ *  Shared with the Parent (or Boot Image) where they Match.
+ *  Memory Pages never Written since Boot aren't even Compared.
+ *  XO-CHIP's Memory past 4KB isn't Tracked, so every Page of
+ *  it is Compared
+ * 
+ * @param arena - Arena Built from this Core
+ * @param parent - Clone this State was Stepped from (NULL Compares against Boot)
+ * @returns Clone, Valid until the Arena is Cleared
+ */
+const CoreClone* CHIP8::clone(CloneArena& arena, const CoreClone* parent) const {
+    CoreClone* copy = reinterpret_cast<CoreClone*>(arena.block(arena.allocate(sizeof(CoreClone))));
+    memcpy(copy->head, &state, CLONE_HEAD_SIZE);
+    copy->dirtyPages = dirtyPages;
+    copy->xoPages = 0;
+
+    for (u_int32_t page = 0; page < CLONE_PAGES; page++) {
+        // Clean Memory Pages still Match the Boot Image (Block N is Page N)
+        bool isMemory = page >= CLONE_DISPLAY_PAGES;
+        if (isMemory && !((dirtyPages >> (page - CLONE_DISPLAY_PAGES)) & 0x1)) {
+            copy->pages[page] = page;
+            continue;
+        }
+
+        const u_char* bytes = isMemory ? memory + (page - CLONE_DISPLAY_PAGES) * DIRTY_PAGE_SIZE
+                                       : reinterpret_cast<const u_char*>(state.display) + page * DIRTY_PAGE_SIZE;
+        copy->pages[page] = sharePage(arena, parent ? parent->pages[page] : page, bytes);
+    }
+
+    if (mode == MODE_XO_CHIP) {
+        // Pages past 4KB go in a Table, Shared with the Parent's or XO-CHIP's Boot Memory
+        copy->xoPages = arena.allocate(CLONE_XO_PAGES * sizeof(u_int32_t));
+        u_int32_t* table = reinterpret_cast<u_int32_t*>(arena.block(copy->xoPages));
+        const u_int32_t* parentTable = parent ? reinterpret_cast<const u_int32_t*>(arena.block(parent->xoPages)) : nullptr;
+        for (u_int32_t page = 0; page < CLONE_XO_PAGES; page++) {
+            const u_char* bytes = memory + MEMORY_SIZE + page * DIRTY_PAGE_SIZE;
+            table[page] = sharePage(arena, parentTable ? parentTable[page] : arena.xoBootBlock() + page, bytes);
+        }
+    }
+    return copy;
+}
+
+/**
+ * Shares a Page Block if it still Holds the Bytes,
+ *  Copies the Bytes into a new Block Otherwise
+ *
+ * @param arena - Arena to Copy into
+ * @param shared - Block of the Page in the Parent (or Boot Image)
+ * @param bytes - Page's Current Bytes
+ * @returns Block Holding the Page
+ */
+u_int32_t CHIP8::sharePage(CloneArena& arena, u_int32_t shared, const u_char* bytes) {
+    if (memcmp(arena.block(shared), bytes, DIRTY_PAGE_SIZE) == 0)
+        return shared;
+
+    u_int32_t fresh = arena.allocate(DIRTY_PAGE_SIZE);
+    memcpy(arena.block(fresh), bytes, DIRTY_PAGE_SIZE);
+    return fresh;
+}
+
+/**
+ * Replaces the State with a Clone's, Memory Pages Clean in both
+ *  are Skipped and only Pages that Change Drop their Decodes,
+ *  so the Decode Cache Survives Restoring
+ * 
+ * @param arena - Arena the Clone was Made in
+ * @param copy - Clone of a Core Running the same ROM
+ */
+void CHIP8::restore(const CloneArena& arena, const CoreClone* copy) {
+    if (!copy) return;
+
+    memcpy(&state, copy->head, CLONE_HEAD_SIZE);
+    u_char* display = reinterpret_cast<u_char*>(state.display);
+    for (u_int32_t page = 0; page < CLONE_DISPLAY_PAGES; page++)
+        memcpy(display + page * DIRTY_PAGE_SIZE, arena.block(copy->pages[page]), DIRTY_PAGE_SIZE);
+
+    uint64_t pages = dirtyPages | copy->dirtyPages;
+    for (int page = 0; pages; page++, pages >>= 1) {
+        if (!(pages & 0x1)) continue;
+
+        u_char* bytes = memory + page * DIRTY_PAGE_SIZE;
+        const u_char* restored = arena.block(copy->pages[CLONE_DISPLAY_PAGES + page]);
+        if (memcmp(bytes, restored, DIRTY_PAGE_SIZE) == 0) continue;
+        memcpy(bytes, restored, DIRTY_PAGE_SIZE);
+
+        // Fused Entries cover 4 Bytes, so up to 3 Addresses before the Page
+        for (int addr = std::max(0, page * DIRTY_PAGE_SIZE - 3); addr < (page + 1) * DIRTY_PAGE_SIZE; addr++)
+            decodeCache[addr].op = OP_UNDECODED;
+    }
+
+    // XO-CHIP's Memory past 4KB isn't Decode Cached, Copy what Differs
+    if (copy->xoPages) {
+        const u_int32_t* table = reinterpret_cast<const u_int32_t*>(arena.block(copy->xoPages));
+        for (u_int32_t page = 0; page < CLONE_XO_PAGES; page++) {
+            u_char* bytes = memory + MEMORY_SIZE + page * DIRTY_PAGE_SIZE;
+            const u_char* restored = arena.block(table[page]);
+            if (memcmp(bytes, restored, DIRTY_PAGE_SIZE)) memcpy(bytes, restored, DIRTY_PAGE_SIZE);
+        }
+    }
+
+    dirtyPages = copy->dirtyPages;
+    drawFlag = true;
 }
 
 /**
@@ -253,19 +988,22 @@ void CHIP8::setOutputStream(std::ostream *out) {
  * @param - isSequential - Sequential run or Infinite Loop (for threading)
  */
 void CHIP8::run(bool isSequential) {
+    // Halted CPU doesn't Run
+    if (state.fault) return;
+
     // Loop through Memory
     do {
         // Memory[PC]    -> Left-Most Nibble
         // Memory[PC+1]  -> Right-Most Nibble
-        u_int16_t opcode = (memory[PC] << 8) | memory[PC + 1];
+        u_int16_t opcode = (memory[state.PC & memoryMask] << 8) | memory[(state.PC + 1) & memoryMask];
         if (out) *out << "[" << std::hex << std::setw(2) << std::setfill('0') << std::uppercase
-                      << PC << "] " << std::setw(2) << std::setfill('0')
-                      << int(memory[PC]) << ' ' << std::setw(2) << std::setfill('0')
-                      << int(memory[PC + 0x1])
+                      << state.PC << "] " << std::setw(2) << std::setfill('0')
+                      << int(opcode >> 8) << ' ' << std::setw(2) << std::setfill('0')
+                      << int(opcode & 0xFF)
                       << std::resetiosflags(std::ios::uppercase | std::ios::hex) << '\t';
 
         if (out) *out << std::hex;
-        switch (memory[PC] & 0xF0) {  // Based on the First Nibble
+        switch ((opcode >> 8) & 0xF0) {  // Based on the First Nibble
         case 0x00:                    // System Call (SYS addr)
             // NNN = Address
             if ((opcode & 0xFFF) == 0x0E0) {  // Clear Screen (CLS)
@@ -274,6 +1012,27 @@ void CHIP8::run(bool isSequential) {
             } else if ((opcode & 0xFFF) == 0x0EE) {  // Return from Subroutine (RET)
                 if (out) *out << "RET";
                 RET();
+            } else if ((opcode & 0xFFF0) == 0x00C0) {  // Scroll Down N Lines (SCD nibble)
+                if (out) *out << "SCD " << (opcode & 0xF);
+                SCD(opcode & 0xF);
+            } else if ((opcode & 0xFFF0) == 0x00D0) {  // Scroll Up N Lines (SCU nibble)
+                if (out) *out << "SCU " << (opcode & 0xF);
+                SCU(opcode & 0xF);
+            } else if ((opcode & 0xFFF) == 0x0FB) {  // Scroll Right 4 Pixels (SCR)
+                if (out) *out << "SCR";
+                SCR();
+            } else if ((opcode & 0xFFF) == 0x0FC) {  // Scroll Left 4 Pixels (SCL)
+                if (out) *out << "SCL";
+                SCL();
+            } else if ((opcode & 0xFFF) == 0x0FD) {  // Exit Interpreter (EXIT)
+                if (out) *out << "EXIT";
+                EXIT();
+            } else if ((opcode & 0xFFF) == 0x0FE) {  // 64x32 Display (LOW)
+                if (out) *out << "LOW";
+                LOW();
+            } else if ((opcode & 0xFFF) == 0x0FF) {  // 128x64 Display (HIGH)
+                if (out) *out << "HIGH";
+                HIGH();
             } else {  // Output Data as in on Line
                 if (out) *out << std::setw(4) << opcode;
                 break;
@@ -287,7 +1046,7 @@ void CHIP8::run(bool isSequential) {
 
             // Decrement PC, since it's incrementing at the End
             //  which restores it Address Jumped to
-            PC -= 0x02;
+            state.PC -= 0x02;
             break;
 
         case 0x20:  // Calls Subroutine (CALL addr)
@@ -302,7 +1061,7 @@ void CHIP8::run(bool isSequential) {
             // Obtain Constant Byte
             if (out) *out << ", " << (opcode & 0xFF);
 
-            SE(V[(opcode & 0xF00) >> 8], opcode & 0xFF);
+            SE(state.V[(opcode & 0xF00) >> 8], opcode & 0xFF);
             break;
 
         case 0x40:  // Skip next if (reg[x] != NN) (SNE Vx, byte)
@@ -311,15 +1070,28 @@ void CHIP8::run(bool isSequential) {
             // Obtain Constant Byte
             if (out) *out << ", " << (opcode & 0xFF);
 
-            SNE(V[(opcode & 0xF00) >> 8], opcode & 0xFF);
+            SNE(state.V[(opcode & 0xF00) >> 8], opcode & 0xFF);
             break;
 
         case 0x50:  // Skip next if (reg[x] == reg[y]) (SE Vx, Vy)
+            if (mode != MODE_XO_CHIP && ((opcode & 0xF) == 0x2 || (opcode & 0xF) == 0x3)) {
+                if (out) *out << std::setw(4) << opcode;  // XO-CHIP Only, NOP
+                break;
+            } else if ((opcode & 0xF) == 0x2) {  // Store reg[x] to reg[y] in mem starting at location I
+                if (out) *out << "LD [I], V" << ((opcode & 0xF00) >> 8) << " - V" << ((opcode & 0xF0) >> 4);
+                SAVE((opcode & 0xF00) >> 8, (opcode & 0xF0) >> 4);
+                break;
+            } else if ((opcode & 0xF) == 0x3) {  // Read reg[x] to reg[y] from mem starting at location I
+                if (out) *out << "LD V" << ((opcode & 0xF00) >> 8) << " - V" << ((opcode & 0xF0) >> 4) << ", [I]";
+                LOAD((opcode & 0xF00) >> 8, (opcode & 0xF0) >> 4);
+                break;
+            }
+
             if (out) *out << "SE V" << ((opcode & 0xF00) >> 8);
 
             // Obtain next Register Byte
             if (out) *out << ", V" << ((opcode & 0xF0) >> 4);  // Reg[Y] -> 0x5XY0
-            SE(V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+            SE(state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
             break;
 
         case 0x60:  // Set reg[x] = NN (LD Vx, byte)
@@ -327,7 +1099,7 @@ void CHIP8::run(bool isSequential) {
 
             // Obtain Constant
             if (out) *out << ", " << (opcode & 0xFF);
-            LD(&V[(opcode & 0xF00) >> 8], (opcode & 0xFF));
+            LD(&state.V[(opcode & 0xF00) >> 8], (opcode & 0xFF));
             break;
 
         case 0x70:  // Adds reg[x] += NN (ADD Vx, byte)
@@ -337,7 +1109,7 @@ void CHIP8::run(bool isSequential) {
             if (out) *out << ", " << (opcode & 0xFF);
 
             // Add and Wraparound without Carry Flag
-            ADD(&V[(opcode & 0xF00) >> 8], (opcode & 0xFF), false);
+            ADD(&state.V[(opcode & 0xF00) >> 8], (opcode & 0xFF), false);
             break;
 
         case 0x80:  // Register on Register Operations
@@ -346,51 +1118,51 @@ void CHIP8::run(bool isSequential) {
             case 0x0:                // Set reg[x] = reg[y]
                 if (out) *out << "LD V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
-                LD(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+                LD(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
                 break;
             case 0x1:  // Set reg[x] |= reg[y]
                 if (out) *out << "OR V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
 
-                OR(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+                OR(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
                 break;
             case 0x2:  // Set reg[x] &= reg[y]
                 if (out) *out << "AND V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
 
-                AND(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+                AND(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
                 break;
             case 0x3:  // Set reg[x] ^= reg[y]
                 if (out) *out << "XOR V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
 
-                XOR(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+                XOR(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
                 break;
             case 0x4:  // Set reg[x] += reg[y]
                 if (out) *out << "ADD V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << (((opcode & 0xF0) >> 4) >> 4);
-                ADD(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xFF) >> 4], true);
+                ADD(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xFF) >> 4], true);
                 break;
             case 0x5:  // Set reg[x] -= reg[y]
                 if (out) *out << "SUB V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
-                SUB(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+                SUB(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
                 break;
             case 0x6:  // Shift reg[x] >>= 1
                 if (out) *out << "SHR V" << ((opcode & 0xF00) >> 8);
 
-                SHR(&V[(opcode & 0xF00) >> 8], &V[(opcode & 0xF0) >> 4]);
+                SHR(&state.V[(opcode & 0xF00) >> 8], &state.V[(opcode & 0xF0) >> 4]);
                 break;
 
             case 0x7:  // Set reg[x] = reg[y] - reg[x]
                 if (out) *out << "SUBN V" << ((opcode & 0xF00) >> 8);
                 if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
-                SUBN(&V[(opcode & 0xF00) >> 8], V[(opcode & 0xF0) >> 4]);
+                SUBN(&state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
                 break;
 
             case 0xE:  // Shift regx[] <<= 1
                 if (out) *out << "SHL V" << ((opcode & 0xF00) >> 8);
-                SHL(&V[(opcode & 0xF00) >> 8], &V[(opcode & 0xF0) >> 4]);
+                SHL(&state.V[(opcode & 0xF00) >> 8], &state.V[(opcode & 0xF0) >> 4]);
                 break;
 
             default:
@@ -405,8 +1177,8 @@ void CHIP8::run(bool isSequential) {
             if (out) *out << "SNE V" << ((opcode & 0xF00) >> 8);
 
             // Obtain next Register Byte
-            if (out) *out << ", V" << (opcode & 0xF0);
-            SNE(V[(opcode & 0xF00) >> 8], V[opcode & 0xFF]);
+            if (out) *out << ", V" << ((opcode & 0xF0) >> 4);
+            SNE(state.V[(opcode & 0xF00) >> 8], state.V[(opcode & 0xF0) >> 4]);
             break;
 
         case 0xA0:  // Set Register I = addr
@@ -422,11 +1194,11 @@ void CHIP8::run(bool isSequential) {
 
             // Output Address
             if (out) *out << (opcode & 0xFFF);
-            JP((opcode & 0xFFF) + V[0x0]);
+            JP((opcode & 0xFFF) + state.V[0x0]);
 
             // Decrement PC, since it's incrementing at the End
             //  which restores it Address Jumped to
-            PC -= 0x02;
+            state.PC -= 0x02;
 
             break;
 
@@ -435,7 +1207,7 @@ void CHIP8::run(bool isSequential) {
 
             // Get Const Byte
             if (out) *out << ", " << (opcode & 0xFF);
-            RND(&V[(opcode & 0xF00) >> 8], (opcode & 0xFF));
+            RND(&state.V[(opcode & 0xF00) >> 8], (opcode & 0xFF));
             break;
 
         case 0xD0:  // Draw n-byte sprite at mem (reg[x], reg[y])
@@ -445,28 +1217,60 @@ void CHIP8::run(bool isSequential) {
             if (out) *out << ", V" << ((opcode & 0xF0) >> 4)  // Vy
                           << ", " << (opcode & 0x0F);         // n
 
-            DRW(&V[(opcode & 0xF00) >> 8], &V[(opcode & 0xF0) >> 4], (opcode & 0x0F));
+            DRW(&state.V[(opcode & 0xF00) >> 8], &state.V[(opcode & 0xF0) >> 4], (opcode & 0x0F));
             break;
 
         case 0xE0:  // Skip/No-Skip next Instruction if Key in reg[x] is pressed
             // Check (Skip/No-Skip)
             if ((opcode & 0xFF) == 0x9E) {  // Skip
                 if (out) *out << "SKP V" << ((opcode & 0xF00) >> 8);
-                SKP(V[((opcode & 0xF00) >> 8)]);
+                SKP(state.V[((opcode & 0xF00) >> 8)]);
             } else {  // addr == 0xA1 (No Skip)
                 if (out) *out << "SKNP V" << ((opcode & 0xF00) >> 8);
-                SKNP(V[((opcode & 0xF00) >> 8)]);
+                SKNP(state.V[((opcode & 0xF00) >> 8)]);
             }
 
             break;
 
         case 0xF0:  // Timer | Key Press | Index Register | Sprite
+            // XO-CHIP Only, NOPs in CHIP-8 Mode (F000 is then 2 Bytes)
+            if (mode != MODE_XO_CHIP && ((opcode & 0xFF) <= 0x02 || (opcode & 0xFF) == 0x3A)) {
+                if (out) *out << std::setw(4) << opcode;
+                break;
+            }
+
             // Action Type
             switch (opcode & 0xFF) {
+            case 0x00:  // Set I to the 16-bit Address in the Next 2 Bytes (LD I, long NNNN)
+                if (opcode != 0xF000) {
+                    if (out) *out << std::setw(4) << opcode;
+                    break;
+                }
+
+                LD(u_int16_t((memory[(state.PC + 0x2) & memoryMask] << 8) | memory[(state.PC + 0x3) & memoryMask]));
+                if (out) *out << "LD I, long " << state.I;
+                state.PC += 0x2;  // 4 Byte Instruction
+                break;
+
+            case 0x01:  // Select Planes n to Draw on (PLANE n)
+                if (out) *out << "PLANE " << ((opcode & 0xF00) >> 8);
+                PLANE((opcode & 0xF00) >> 8);
+                break;
+
+            case 0x02:  // Load the Audio Pattern from mem starting at location I
+                if (opcode != 0xF002) {
+                    if (out) *out << std::setw(4) << opcode;
+                    break;
+                }
+
+                if (out) *out << "AUDIO";
+                AUDIO();
+                break;
+
             case 0x07:  // Delay Timer Value by DT
                 if (out) *out << "LD V" << ((opcode & 0xF00) >> 8) << ", DT";
 
-                LD(&V[(opcode & 0xF00) >> 8], dTimer);
+                LD(&state.V[(opcode & 0xF00) >> 8], state.dTimer);
                 break;
 
             case 0x0A:  // Wait for Key Press and store Key in reg[x]
@@ -474,26 +1278,27 @@ void CHIP8::run(bool isSequential) {
 
                 // Decrement PC, since it'll increment at the end
                 //  kind of "halting" PC in the same spot
-                PC -= 0x2;
-                SKP(V[(opcode & 0xF00) >> 8]);  // Continue IF key is pressed (restoring the PC back)
+                state.PC -= 0x2;
+                SKP(state.V[(opcode & 0xF00) >> 8]);  // Continue IF key is pressed (restoring the PC back)
                 break;
 
             case 0x15:  // Set Delay Timer to reg[x]
                 if (out) *out << "LD DT, V" << ((opcode & 0xF00) >> 8);
 
-                LD(&dTimer, V[(opcode & 0xF00) >> 8]);
+                LD(&state.dTimer, state.V[(opcode & 0xF00) >> 8]);
                 break;
 
             case 0x18:  // Set Sound Timer to reg[x]
                 if (out) *out << "LD ST, V" << ((opcode & 0xF00) >> 8);
 
-                LD(&sTimer, V[(opcode & 0xF00) >> 8]);
+                LD(&state.sTimer, state.V[(opcode & 0xF00) >> 8]);
+                if (state.sTimer) soundFlag = true;
                 break;
 
             case 0x1E:  // Set values of I to reg[x] I += reg[x]
                 if (out) *out << "ADD I, V" << ((opcode & 0xF00) >> 8);
 
-                ADD(&I, V[(opcode & 0xF00) >> 8]);
+                ADD(&state.I, state.V[(opcode & 0xF00) >> 8]);
                 break;
 
             case 0x29:  // Set I to the location of Sprite Digit reg[x]
@@ -503,23 +1308,45 @@ void CHIP8::run(bool isSequential) {
                 // Since the Hex Fonts start at address 0x00-0x50
                 //  and each Hex Font is 5Bytes, we offset by 0x5
                 //  with the desired font value
-                LD(u_int16_t(V[(opcode & 0xF00) >> 8] * 0x5));
+                LD(u_int16_t(state.V[(opcode & 0xF00) >> 8] * 0x5));
+                break;
+
+            case 0x30:  // Set I to the location of 8x10 Sprite Digit reg[x]
+                if (out) *out << "LD HF, V" << ((opcode & 0xF00) >> 8);
+
+                // Big Fonts are 10Bytes each, starting at BIG_FONT_START
+                LD(u_int16_t(BIG_FONT_START + (state.V[(opcode & 0xF00) >> 8] & 0xF) * 10));
                 break;
 
             case 0x33:  // Store BCD rep of reg[x] in mem locaion I, I+1, and I+2
                 if (out) *out << "LD B, V" << ((opcode & 0xF00) >> 8);
-                LD(V[(opcode & 0xF00) >> 8]);
+                LD(state.V[(opcode & 0xF00) >> 8]);
+                break;
+
+            case 0x3A:  // Set the Audio Pattern's Pitch to reg[x]
+                if (out) *out << "PITCH V" << ((opcode & 0xF00) >> 8);
+                LD(&state.pitch, state.V[(opcode & 0xF00) >> 8]);
                 break;
 
             case 0x55:  // Store reg[0] to reg[x] in mem starting at location I
                 if (out) *out << "LD [I], V" << ((opcode & 0xF00) >> 8);
-                LD(&I, (opcode & 0xF00) >> 8);
+                LD(&state.I, (opcode & 0xF00) >> 8);
                 break;
 
             case 0x65:  // Read reg[0] to reg[x] in mem starting at location I
                 if (out) *out << "LD V" << ((opcode & 0xF00) >> 8)
                               << ", [I]";
-                LD(((opcode & 0xF00) >> 8), &I);
+                LD(((opcode & 0xF00) >> 8), &state.I);
+                break;
+
+            case 0x75:  // Store reg[0] to reg[x] in the Flag Registers
+                if (out) *out << "LD R, V" << ((opcode & 0xF00) >> 8);
+                STR((opcode & 0xF00) >> 8);
+                break;
+
+            case 0x85:  // Read reg[0] to reg[x] from the Flag Registers
+                if (out) *out << "LD V" << ((opcode & 0xF00) >> 8) << ", R";
+                LDR((opcode & 0xF00) >> 8);
                 break;
 
             default:
@@ -538,12 +1365,173 @@ void CHIP8::run(bool isSequential) {
 
         if (out) *out << '\n';
 
-        // Decrement Delay Timer
-        if (dTimer > 0) dTimer--;
+        // Decrement Delay & Sound Timers
+        if (state.dTimer > 0) state.dTimer--;
+        if (state.sTimer > 0) state.sTimer--;
 
         // Go to next Line
-        PC += 0x2;
-    } while (!isSequential && PC < 0xFFF);  // Make sure PC stays within Memory
+        state.PC += 0x2;
+    } while (!isSequential && state.PC < 0xFFF && !state.fault);  // Make sure PC stays within Memory
+}
+
+/**
+ * Runs the given number of Instructions. Same Behavior as
+ *  CHIP8::run without Instruction Output
+ * 
+ * @param count - Number of Instructions to Run
+ */
+void CHIP8::step(u_int32_t count) {
+    // Translated Code runs while it Covers the PC, Interpreter fills the Gaps
+    while (compiled && count && !state.fault) {
+        count -= compiled->run(*this, state, count, &dirtyPages);
+        if (count == 0) return;
+
+        interpret(1);
+        count--;
+    }
+
+    interpret(count);
+}
+
+/**
+ * Runs the given number of Instructions, Decoding each
+ *  Address only on it's first Visit
+ * 
+ * @param count - Number of Instructions to Run
+ */
+void CHIP8::interpret(u_int32_t count) {
+    while (count-- && !state.fault) {
+        // Decode on Cache Miss, XO-CHIP's Upper Memory on every Visit
+        const bool isCached = state.PC < MEMORY_SIZE;
+        Instruction ins = isCached ? decodeCache[state.PC] : Instruction{OP_UNDECODED, 0x0, 0x0, 0x0};
+        if (ins.op == OP_UNDECODED) {
+            ins = decodeAt(state.PC & memoryMask);
+            if (isCached) decodeCache[state.PC] = ins;
+        }
+        const u_char kk = (ins.y << 4) | ins.n;
+        const u_int16_t nnn = (ins.x << 8) | kk;
+
+        // Fused Pairs, Run the First Half then the Second only
+        //  if it's Reached and there's Count left for it
+        if (ins.op >= OP_SE_JP) {
+            const u_int16_t a = (ins.x << 4) | (ins.y >> 4);   // First's Low 12 Bits
+            const u_int16_t b = ((ins.y & 0xF) << 8) | ins.n;  // Second's Low 12 Bits
+            const u_int16_t pc = state.PC;
+
+            switch (ins.op) {
+            case OP_SE_JP:      state.PC += state.V[a >> 8] == (a & 0xFF) ? 0x2 : 0x0; break;  // Skips a JP, never F000
+            case OP_SNE_JP:     state.PC += state.V[a >> 8] != (a & 0xFF) ? 0x2 : 0x0; break;
+            case OP_LD_LD:
+            case OP_LD_SKNP:    LD(&state.V[a >> 8], u_char(a & 0xFF)); break;
+            case OP_ADD_SE:     ADD(&state.V[a >> 8], a & 0xFF, false); break;
+            default:            LD(a); break;  // LD I, NNN
+            }
+            if (state.dTimer > 0) state.dTimer--;
+            if (state.sTimer > 0) state.sTimer--;
+            state.PC += 0x2;
+
+            // Skipped over the Second, or out of Count
+            if (state.PC != pc + 0x2 || count == 0) continue;
+            count--;
+
+            switch (ins.op) {
+            case OP_SE_JP:
+            case OP_SNE_JP:     JP(b); state.PC -= 0x2; break;
+            case OP_LD_LD:      LD(&state.V[b >> 8], u_char(b & 0xFF)); break;
+            case OP_LD_SKNP:    SKNP(state.V[b >> 8]); break;
+            case OP_ADD_SE:     SE(state.V[b >> 8], b & 0xFF); break;
+            case OP_LD_I_ADD_I: ADD(&state.I, state.V[b >> 8]); break;
+            default:            DRW(&state.V[b >> 8], &state.V[(b >> 4) & 0xF], b & 0xF); break;
+            }
+            if (state.dTimer > 0) state.dTimer--;
+            if (state.sTimer > 0) state.sTimer--;
+            state.PC += 0x2;
+            continue;
+        }
+
+        switch (ins.op) {
+        case OP_CLS:        CLS(); break;
+        case OP_RET:        RET(); break;
+        case OP_JP:         JP(nnn); state.PC -= 0x2; break;
+        case OP_CALL:       CALL(nnn); break;
+        case OP_SE_BYTE:    SE(state.V[ins.x], kk); break;
+        case OP_SNE_BYTE:   SNE(state.V[ins.x], kk); break;
+        case OP_SE_REG:     SE(state.V[ins.x], state.V[ins.y]); break;
+        case OP_LD_BYTE:    LD(&state.V[ins.x], kk); break;
+        case OP_ADD_BYTE:   ADD(&state.V[ins.x], kk, false); break;
+        case OP_LD_REG:     LD(&state.V[ins.x], state.V[ins.y]); break;
+        case OP_OR:         OR(&state.V[ins.x], state.V[ins.y]); break;
+        case OP_AND:        AND(&state.V[ins.x], state.V[ins.y]); break;
+        case OP_XOR:        XOR(&state.V[ins.x], state.V[ins.y]); break;
+        case OP_ADD_REG:    ADD(&state.V[ins.x], state.V[ins.y], true); break;
+        case OP_SUB:        SUB(&state.V[ins.x], state.V[ins.y]); break;
+        case OP_SHR:        SHR(&state.V[ins.x], &state.V[ins.y]); break;
+        case OP_SUBN:       SUBN(&state.V[ins.x], state.V[ins.y]); break;
+        case OP_SHL:        SHL(&state.V[ins.x], &state.V[ins.y]); break;
+        case OP_SNE_REG:    SNE(state.V[ins.x], state.V[ins.y]); break;
+        case OP_LD_I:       LD(nnn); break;
+
+        // Flag is Dead if the Next Instruction Runs, Stored if this is the Last
+        case OP_ADD_REG_NF: if (!count) ADD(&state.V[ins.x], state.V[ins.y], true); else state.V[ins.x] += state.V[ins.y]; break;
+        case OP_SUB_NF:     if (!count) SUB(&state.V[ins.x], state.V[ins.y]); else state.V[ins.x] -= state.V[ins.y]; break;
+        case OP_SHR_NF:     if (!count) SHR(&state.V[ins.x], &state.V[ins.y]); else state.V[ins.x] >>= 1; break;
+        case OP_SUBN_NF:    if (!count) SUBN(&state.V[ins.x], state.V[ins.y]); else state.V[ins.x] = state.V[ins.y] - state.V[ins.x]; break;
+        case OP_SHL_NF:     if (!count) SHL(&state.V[ins.x], &state.V[ins.y]); else state.V[ins.x] <<= 1; break;
+
+        case OP_JP_V0:      JP(nnn + state.V[0x0]); state.PC -= 0x2; break;
+        case OP_RND:        RND(&state.V[ins.x], kk); break;
+        case OP_DRW:        DRW(&state.V[ins.x], &state.V[ins.y], ins.n); break;
+        case OP_SKP:        SKP(state.V[ins.x]); break;
+        case OP_SKNP:       SKNP(state.V[ins.x]); break;
+        case OP_LD_VX_DT:   LD(&state.V[ins.x], state.dTimer); break;
+        case OP_LD_VX_K:    state.PC -= 0x2; SKP(state.V[ins.x]); break;
+        case OP_LD_DT:      LD(&state.dTimer, state.V[ins.x]); break;
+        case OP_LD_ST:      LD(&state.sTimer, state.V[ins.x]); if (state.sTimer) soundFlag = true; break;
+        case OP_ADD_I:      ADD(&state.I, state.V[ins.x]); break;
+        case OP_LD_F:       LD(u_int16_t(state.V[ins.x] * 0x5)); break;
+        case OP_LD_B:       LD(state.V[ins.x]); break;
+        case OP_LD_MEM_VX:  LD(&state.I, ins.x); break;
+        case OP_LD_VX_MEM:  LD(ins.x, &state.I); break;
+        case OP_SCD:        SCD(ins.n); break;
+        case OP_SCR:        SCR(); break;
+        case OP_SCL:        SCL(); break;
+        case OP_EXIT:       EXIT(); break;
+        case OP_LOW:        LOW(); break;
+        case OP_HIGH:       HIGH(); break;
+        case OP_LD_HF:      LD(u_int16_t(BIG_FONT_START + (state.V[ins.x] & 0xF) * 10)); break;
+        case OP_LD_R_VX:    STR(ins.x); break;
+        case OP_LD_VX_R:    LDR(ins.x); break;
+        case OP_SCU:        SCU(ins.n); break;
+        case OP_LD_MEM_RANGE: SAVE(ins.x, ins.y); break;
+        case OP_LD_RANGE_MEM: LOAD(ins.x, ins.y); break;
+        case OP_LD_I_LONG:  LD(u_int16_t((memory[(state.PC + 0x2) & memoryMask] << 8) | memory[(state.PC + 0x3) & memoryMask])); state.PC += 0x2; break;
+        case OP_PLANE:      PLANE(ins.x); break;
+        case OP_LD_PATTERN: AUDIO(); break;
+        case OP_LD_PITCH:   LD(&state.pitch, state.V[ins.x]); break;
+        default:            break;
+        }
+
+        // Decrement Delay & Sound Timers
+        if (state.dTimer > 0) state.dTimer--;
+        if (state.sTimer > 0) state.sTimer--;
+
+        // Go to next Line
+        state.PC += 0x2;
+    }
+}
+
+/**
+ * Runs a Single Frame's worth of Instructions
+ * 
+ * @param count - Instructions per Frame
+ * @returns True if the Display Changed during the Frame
+ */
+bool CHIP8::runFrame(u_int32_t count) {
+    step(count);
+
+    bool isDrawn = drawFlag;
+    drawFlag = false;
+    return isDrawn;
 }
 
 /**
@@ -551,7 +1539,10 @@ void CHIP8::run(bool isSequential) {
  * Clears the Screen
  */
 void CHIP8::CLS() {
-    memset(display, 0x00, 64 * 32);
+    for (u_char plane = 0; plane < DISPLAY_PLANES; plane++) {
+        if ((state.planes >> plane) & 0x1)  // XO-CHIP Clears only Selected Planes
+            memset(state.display[plane], 0x00, sizeof(state.display[plane]));
+    }
     drawFlag = true;
 }
 
@@ -560,8 +1551,12 @@ void CHIP8::CLS() {
  * Return from Subroutine, return
  */
 void CHIP8::RET() {
-    PC = stack.top();
-    stack.pop();
+    if (state.SP == 0) {
+        state.fault = FAULT_STACK_UNDERFLOW;
+        state.PC -= 0x2;  // Halt on the Faulting Instruction
+        return;
+    }
+    state.PC = state.stack[--state.SP];
 }
 
 /**
@@ -572,7 +1567,7 @@ void CHIP8::RET() {
  * @param addr - 2 Byte Address to jump to
  */
 void CHIP8::JP(u_int16_t addr) {
-    PC = addr;  // Set PC to NNN
+    state.PC = addr;  // Set PC to NNN
 }
 
 /**
@@ -584,12 +1579,17 @@ void CHIP8::JP(u_int16_t addr) {
  * @param addr - 2 Byte Address to CALL
  */
 void CHIP8::CALL(u_int16_t addr) {
-    stack.push(PC);  // Push current PC to stack
+    if (state.SP >= 16) {
+        state.fault = FAULT_STACK_OVERFLOW;
+        state.PC -= 0x2;  // Halt on the Faulting Instruction
+        return;
+    }
+    state.stack[state.SP++] = state.PC;  // Push current PC to stack
 
     // Set PC to NNN - 0x02
     //  reason is because after CALL, PC+=0x02
     //  until next Instruction is reached
-    PC = addr - 0x2;
+    state.PC = addr - 0x2;
 }
 
 /**
@@ -601,7 +1601,7 @@ void CHIP8::CALL(u_int16_t addr) {
  */
 void CHIP8::SE(u_char byte1, u_char byte2) {
     if (byte1 == byte2)
-        PC += 0x2;
+        skip();
 }
 
 /**
@@ -613,7 +1613,7 @@ void CHIP8::SE(u_char byte1, u_char byte2) {
  */
 void CHIP8::SNE(u_char byte1, u_char byte2) {
     if (byte1 != byte2)
-        PC += 0x2;
+        skip();
 }
 
 /**
@@ -638,7 +1638,7 @@ void CHIP8::LD(u_char* regPtr, u_char byte) {
  */
 void CHIP8::ADD(u_char* regPtr, u_char byte, bool checkFlag) {
     if (checkFlag)
-        V[0xF] = *regPtr + byte > 0xFF ? 0x1 : 0x0;
+        state.V[0xF] = *regPtr + byte > 0xFF ? 0x1 : 0x0;
     *regPtr = (*regPtr + byte) & 0xFF;
 }
 
@@ -684,7 +1684,7 @@ void CHIP8::XOR(u_char* regPtr, u_char byte) {
  * @param byte - Byte that will be Subtracted by Vx
  */
 void CHIP8::SUB(u_char* regPtr, u_char byte) {
-    V[0xF] = (*regPtr > byte) ? 0x1 : 0x0;
+    state.V[0xF] = (*regPtr > byte) ? 0x1 : 0x0;
     *regPtr -= byte;
 }
 
@@ -698,7 +1698,7 @@ void CHIP8::SUB(u_char* regPtr, u_char byte) {
  * @param regPtr2 - Vy Register used to Shift 1 and set to Vx (70s and 80s ROMs)
  */
 void CHIP8::SHR(u_char* regPtr1, u_char* regPtr2) {
-    V[0xF] = (*regPtr1 & 0x1) ? 0x1 : 0x0;  // Set Carry Flag if LSB is 1
+    state.V[0xF] = (*regPtr1 & 0x1) ? 0x1 : 0x0;  // Set Carry Flag if LSB is 1
 
     // 70s and 80s Supported ROMs
     // *regPtr1 = *regPtr2 >> 1;
@@ -716,7 +1716,7 @@ void CHIP8::SHR(u_char* regPtr1, u_char* regPtr2) {
  * @param byte - Byte being sutracted by Vx
  */
 void CHIP8::SUBN(u_char* regPtr, u_char byte) {
-    V[0xF] = (byte > *regPtr) ? 0x1 : 0x0;
+    state.V[0xF] = (byte > *regPtr) ? 0x1 : 0x0;
     *regPtr = byte - *regPtr;
 }
 
@@ -730,7 +1730,7 @@ void CHIP8::SUBN(u_char* regPtr, u_char byte) {
  * @param regPtr2 - Vy Register used to Shift 1 and set to Vx (70s and 80s ROMs)
  */
 void CHIP8::SHL(u_char* regPtr1, u_char* regPtr2) {
-    V[0xF] = (*regPtr1 & 0x8000) ? 0x1 : 0x0;  // Set Carry Flag if MSB is 1
+    state.V[0xF] = (*regPtr1 & 0x80) ? 0x1 : 0x0;  // Set Carry Flag if MSB is 1
 
     // 70s and 80s Supported ROMs
     // *regPtr1 = *regPtr2 << 1;
@@ -747,7 +1747,7 @@ void CHIP8::SHL(u_char* regPtr1, u_char* regPtr2) {
  * @param addr - 2Byte Address being set to Index Register
  */
 void CHIP8::LD(u_int16_t addr) {
-    I = addr;
+    state.I = addr;
 }
 
 /**
@@ -759,28 +1759,20 @@ void CHIP8::LD(u_int16_t addr) {
  * @param byte - Byte to AND from Random Generated Byte
  */
 void CHIP8::RND(u_char* regPtr, u_char byte) {
-    *regPtr = (rand() % 0xFF) & byte;
-}
-
-/**
- * Wraps index around a range
- * 
- * @param index - Index Position between [0-max_size]
- * @param max_size - Max Range to limit index to
- */
-u_char wrap(u_char index, u_char max_size) {
-    if (index < 0)
-        return index + max_size;
-    else if (index >= max_size)
-        return index % max_size;
-    else
-        return index;
+    // xorshift64*, High Byte of the Scrambled Output
+    state.rng ^= state.rng >> 12;
+    state.rng ^= state.rng << 25;
+    state.rng ^= state.rng >> 27;
+    *regPtr = u_char((state.rng * 0x2545F4914F6CDD1DULL) >> 56) & byte;
 }
 
 /**
  * Opcode(s): DXYN
  * Display n-byte sprite at location I at (Vx, Vy) 
  * Reads n-bytes from memory starting at location I
+ * In Hires, DXY0 Draws a 16x16 Sprite (2 Bytes per Row)
+ * XO-CHIP Draws on each Selected Plane, each taking the
+ *  Next Sprite's Bytes after the Previous Plane's
  * VF = Collision
  * 
  * @param regPtrX - Vx Register to set Sprite at x-position
@@ -789,29 +1781,102 @@ u_char wrap(u_char index, u_char max_size) {
  */
 void CHIP8::DRW(u_char* regPtrX, u_char* regPtrY, u_char nBytes) {
     // Assume No Overlap
-    V[0xF] = 0x0;
+    state.V[0xF] = 0x0;
+
+    u_int16_t addr = state.I;
+    for (u_char plane = 0; plane < DISPLAY_PLANES; plane++) {
+        if (!((state.planes >> plane) & 0x1)) continue;
+
+        if (state.hires)
+            addr = DRW128(state.display[plane], *regPtrX, *regPtrY, nBytes, addr);
+        else
+            addr = DRW64(state.display[plane], *regPtrX, *regPtrY, nBytes, addr);
+    }
+
+    drawFlag = true;
+}
+
+/**
+ * DXYN on a Lores Plane, Sprite Rows are Rotated
+ *  into the 64-bit Row so Columns Wrap around
+ * 
+ * @param plane - Plane's Rows (CHIP8State::display[plane])
+ * @param x - X-Coord (Vx)
+ * @param y - Y-Coord (Vy)
+ * @param nBytes - n-Bytes to read from addr
+ * @param addr - Sprite's Address
+ * @returns Address after the Sprite
+ */
+u_int16_t CHIP8::DRW64(uint64_t (*plane)[2], u_char x, u_char y, u_char nBytes, u_int16_t addr) {
+    // Sprite Rows are Rotated into Place so Columns Wrap around
+    u_char shift = x % 64;
+
+    for (u_char row = 0; row < nBytes; row++) {  // Y-Coord
+        // Place Sprite Byte at x = 0, then Rotate Right to x = Vx
+        uint64_t sprite = uint64_t(memory[(addr + row) & memoryMask]) << 56;
+        if (shift)
+            sprite = (sprite >> shift) | (sprite << (64 - shift));
 
-    for (u_int16_t i = I; i < (I + nBytes); i++) {  // Y-Coord
+        // Get y Coordinate with Wapping Handled
+        uint64_t& line = plane[(y + row) % DISPLAY_HEIGHT][0];
 
-        // Draw Width of Sprite
-        for (int bit = 0; bit < 8; bit++) {  // X-Cord
-            // Get x and y Coordinates with Wapping Handled
-            u_char x = wrap((*regPtrX + bit), 64);
-            u_char y = wrap((*regPtrY + (i - I)), 32);
+        // Check for Overlap
+        if (line & sprite)
+            state.V[0xF] = 0x1;
 
-            // Get Individual Pixel
-            u_char pixel = (((memory[i] << bit) & 0x80) >> 7);  //  (Backwards?)
+        // XOR Onto Display
+        line ^= sprite;
+    }
 
-            // Check for Overlap
-            if (display[x][y] && pixel)
-                V[0xF] = 0x1;
+    return addr + nBytes;
+}
 
-            // XOR Onto Display
-            display[x][y] ^= pixel;
+/**
+ * DXYN on a Hires Plane, Sprite Rows are Rotated across
+ *  the 128-bit Row (2 Words) so Columns Wrap around
+ * 
+ * @param plane - Plane's Rows (CHIP8State::display[plane])
+ * @param x - X-Coord (Vx)
+ * @param y - Y-Coord (Vy)
+ * @param nBytes - n-Bytes to read from addr, 0 for 16x16
+ * @param addr - Sprite's Address
+ * @returns Address after the Sprite
+ */
+u_int16_t CHIP8::DRW128(uint64_t (*plane)[2], u_char x, u_char y, u_char nBytes, u_int16_t addr) {
+    bool isWide = nBytes == 0;
+    u_char rows = isWide ? 16 : nBytes;
+    u_char shift = x % DISPLAY_HIRES_WIDTH;
+
+    for (u_char row = 0; row < rows; row++) {
+        // Place Sprite Row at x = 0 of the Left Word
+        uint64_t left, right = 0x0;
+        if (isWide)
+            left = uint64_t((memory[(addr + row * 2) & memoryMask] << 8) |
+                            memory[(addr + row * 2 + 1) & memoryMask]) << 48;
+        else
+            left = uint64_t(memory[(addr + row) & memoryMask]) << 56;
+
+        // Rotate Right to x = Vx, Swapping Words for the Right Half
+        u_char wordShift = shift % 64;
+        if (shift >= 64) {
+            right = left;
+            left = 0x0;
+        }
+        if (wordShift) {
+            uint64_t carry = left << (64 - wordShift);
+            left = (left >> wordShift) | (right << (64 - wordShift));
+            right = (right >> wordShift) | carry;
         }
+
+        // Check for Overlap then XOR Onto Display
+        uint64_t* line = plane[(y + row) % DISPLAY_HIRES_HEIGHT];
+        if ((line[0] & left) | (line[1] & right))
+            state.V[0xF] = 0x1;
+        line[0] ^= left;
+        line[1] ^= right;
     }
 
-    drawFlag = true;
+    return addr + (isWide ? 32 : nBytes);
 }
 
 
@@ -822,8 +1887,9 @@ void CHIP8::DRW(u_char* regPtrX, u_char* regPtrY, u_char nBytes) {
  * @param keyVal - Key Value to listen
  */
 void CHIP8::SKP(u_char keyVal) {
-    if (key[keyVal])
-        PC += 0x2;
+    if (keyProvider || keyObserver) latchKeys();
+    if (key[keyVal & 0xF])
+        skip();
 }
 
 /**
@@ -833,8 +1899,22 @@ void CHIP8::SKP(u_char keyVal) {
  * @param keyVal - Key Value to listen
  */
 void CHIP8::SKNP(u_char keyVal) {
-    if (!key[keyVal])
-        PC += 0x2;
+    if (keyProvider || keyObserver) latchKeys();
+    if (!key[keyVal & 0xF])
+        skip();
+}
+
+/**
+ * Skips over the Next Instruction, which is 4 Bytes
+ *  if it's F000 NNNN in XO-CHIP Mode (CHIP-8 always Skips 2)
+ */
+void CHIP8::skip() {
+    if (mode == MODE_XO_CHIP) {
+        u_int16_t next = state.PC + 0x2;
+        if (memory[next & memoryMask] == 0xF0 && memory[(next + 0x1) & memoryMask] == 0x00)
+            state.PC += 0x2;
+    }
+    state.PC += 0x2;
 }
 
 
@@ -857,9 +1937,12 @@ void CHIP8::ADD(u_int16_t* regPtr, u_char byte) {
  * @param byte - Byte stored in BCD Representation
  */
 void CHIP8::LD(u_char byte) {
-    memory[I] = byte / 100;
-    memory[I + 0x1] = (byte / 10) % 10;
-    memory[I + 0x2] = byte % 10;
+    memory[state.I & memoryMask] = byte / 100;
+    memory[(state.I + 0x1) & memoryMask] = (byte / 10) % 10;
+    memory[(state.I + 0x2) & memoryMask] = byte % 10;
+
+    invalidate(state.I);
+    invalidate(state.I + 0x2);
 }
 
 /**
@@ -867,12 +1950,13 @@ void CHIP8::LD(u_char byte) {
  * Stores Registers V0 through Vx into
  *  memory starting at location I
  * 
- * @param I - Pointer to I Register
+ * @param regI - Pointer to I Register
  * @param regX - Vx Register
  */
-void CHIP8::LD(u_int16_t* I, u_char regX) {
+void CHIP8::LD(u_int16_t* regI, u_char regX) {
     for (u_char i = 0x0; i <= regX; i++) {
-        memory[*I + i] = V[i];
+        memory[(*regI + i) & memoryMask] = state.V[i];
+        invalidate(*regI + i);
     }
 }
 
@@ -881,11 +1965,207 @@ void CHIP8::LD(u_int16_t* I, u_char regX) {
  * Reads Registers V0 through Vx from
  *  memory starting at location I
  * 
- * @param I - Pointer to I Register
+ * @param regI - Pointer to I Register
  * @param regX - Vx Register
  */
-void CHIP8::LD(u_char regX, u_int16_t* I) {
+void CHIP8::LD(u_char regX, u_int16_t* regI) {
     for (u_char i = 0x0; i <= regX; i++) {
-        V[i] = memory[*I + i];
+        state.V[i] = memory[(*regI + i) & memoryMask];
+    }
+}
+
+
+/**
+ * Opcode(s): 00CN
+ * Scrolls the Selected Planes Down N Lines, a memmove
+ *  of whole Rows with Blank Rows Shifted in on Top
+ * 
+ * @param lines - N Lines to Scroll
+ */
+void CHIP8::SCD(u_char lines) {
+    u_char height = state.hires ? DISPLAY_HIRES_HEIGHT : DISPLAY_HEIGHT;
+    if (lines > height) lines = height;
+
+    for (u_char plane = 0; plane < DISPLAY_PLANES; plane++) {
+        if (!((state.planes >> plane) & 0x1)) continue;
+
+        uint64_t (*rows)[2] = state.display[plane];
+        memmove(rows[lines], rows[0], (height - lines) * sizeof(rows[0]));
+        memset(rows[0], 0x0, lines * sizeof(rows[0]));
+    }
+    drawFlag = true;
+}
+
+/**
+ * Opcode(s): 00FB
+ * Scrolls the Selected Planes Right 4 Pixels, Shifting
+ *  the Row's Words with Blank Pixels Shifted in
+ */
+void CHIP8::SCR() {
+    for (u_char plane = 0; plane < DISPLAY_PLANES; plane++) {
+        if (!((state.planes >> plane) & 0x1)) continue;
+
+        uint64_t (*rows)[2] = state.display[plane];
+        if (!state.hires) {
+            for (u_char y = 0; y < DISPLAY_HEIGHT; y++)
+                rows[y][0] >>= 4;
+        } else {
+            for (u_char y = 0; y < DISPLAY_HIRES_HEIGHT; y++) {
+                rows[y][1] = (rows[y][1] >> 4) | (rows[y][0] << 60);
+                rows[y][0] >>= 4;
+            }
+        }
+    }
+    drawFlag = true;
+}
+
+/**
+ * Opcode(s): 00FC
+ * Scrolls the Selected Planes Left 4 Pixels, Shifting
+ *  the Row's Words with Blank Pixels Shifted in
+ */
+void CHIP8::SCL() {
+    for (u_char plane = 0; plane < DISPLAY_PLANES; plane++) {
+        if (!((state.planes >> plane) & 0x1)) continue;
+
+        uint64_t (*rows)[2] = state.display[plane];
+        if (!state.hires) {
+            for (u_char y = 0; y < DISPLAY_HEIGHT; y++)
+                rows[y][0] <<= 4;
+        } else {
+            for (u_char y = 0; y < DISPLAY_HIRES_HEIGHT; y++) {
+                rows[y][0] = (rows[y][0] << 4) | (rows[y][1] >> 60);
+                rows[y][1] <<= 4;
+            }
+        }
+    }
+    drawFlag = true;
+}
+
+/**
+ * Opcode(s): 00FD
+ * Exits the Interpreter, Halting on the Instruction
+ */
+void CHIP8::EXIT() {
+    state.fault = FAULT_EXIT;
+    state.PC -= 0x2;  // Halt on the Exiting Instruction
+}
+
+/**
+ * Opcode(s): 00FE
+ * Switches to the 64x32 Display, Clearing every Plane
+ */
+void CHIP8::LOW() {
+    state.hires = 0x0;
+    memset(state.display, 0x00, sizeof(state.display));
+    drawFlag = true;
+}
+
+/**
+ * Opcode(s): 00FF
+ * Switches to the 128x64 Display, Clearing every Plane
+ */
+void CHIP8::HIGH() {
+    state.hires = 0x1;
+    memset(state.display, 0x00, sizeof(state.display));
+    drawFlag = true;
+}
+
+/**
+ * Opcode(s): FX75
+ * Stores Registers V0 through Vx into
+ *  the Flag Registers
+ * 
+ * @param regX - Vx Register
+ */
+void CHIP8::STR(u_char regX) {
+    for (u_char i = 0x0; i <= regX; i++)
+        state.rpl[i] = state.V[i];
+}
+
+/**
+ * Opcode(s): FX85
+ * Reads Registers V0 through Vx from
+ *  the Flag Registers
+ * 
+ * @param regX - Vx Register
+ */
+void CHIP8::LDR(u_char regX) {
+    for (u_char i = 0x0; i <= regX; i++)
+        state.V[i] = state.rpl[i];
+}
+
+
+/**
+ * Opcode(s): 00DN
+ * Scrolls the Selected Planes Up N Lines, a memmove
+ *  of whole Rows with Blank Rows Shifted in on the Bottom
+ * 
+ * @param lines - N Lines to Scroll
+ */
+void CHIP8::SCU(u_char lines) {
+    u_char height = state.hires ? DISPLAY_HIRES_HEIGHT : DISPLAY_HEIGHT;
+    if (lines > height) lines = height;
+
+    for (u_char plane = 0; plane < DISPLAY_PLANES; plane++) {
+        if (!((state.planes >> plane) & 0x1)) continue;
+
+        uint64_t (*rows)[2] = state.display[plane];
+        memmove(rows[0], rows[lines], (height - lines) * sizeof(rows[0]));
+        memset(rows[height - lines], 0x0, lines * sizeof(rows[0]));
+    }
+    drawFlag = true;
+}
+
+/**
+ * Opcode(s): 5XY2
+ * Stores Registers Vx through Vy into memory
+ *  starting at location I, I is Unchanged.
+ *  Stored in Reverse if X > Y
+ * 
+ * @param regX - Vx Register, Stored at I
+ * @param regY - Vy Register
+ */
+void CHIP8::SAVE(u_char regX, u_char regY) {
+    int step = regX <= regY ? 1 : -1;
+    for (int i = 0; regX + i * step != regY + step; i++) {
+        memory[(state.I + i) & memoryMask] = state.V[regX + i * step];
+        invalidate(state.I + i);
     }
 }
+
+/**
+ * Opcode(s): 5XY3
+ * Reads Registers Vx through Vy from memory
+ *  starting at location I, I is Unchanged.
+ *  Read in Reverse if X > Y
+ * 
+ * @param regX - Vx Register, Read from I
+ * @param regY - Vy Register
+ */
+void CHIP8::LOAD(u_char regX, u_char regY) {
+    int step = regX <= regY ? 1 : -1;
+    for (int i = 0; regX + i * step != regY + step; i++)
+        state.V[regX + i * step] = memory[(state.I + i) & memoryMask];
+}
+
+/**
+ * Opcode(s): FN01
+ * Selects the Planes DXYN, CLS, and the Scrolls work on
+ *  0 = None, 1 = Plane 1, 2 = Plane 2, 3 = Both
+ * 
+ * @param planes - Plane Mask (N)
+ */
+void CHIP8::PLANE(u_char planes) {
+    state.planes = planes & 0x3;
+}
+
+/**
+ * Opcode(s): F002
+ * Loads the 16 Byte Audio Pattern from
+ *  memory starting at location I
+ */
+void CHIP8::AUDIO() {
+    for (u_char i = 0x0; i < sizeof(state.pattern); i++)
+        state.pattern[i] = memory[(state.I + i) & memoryMask];
+}
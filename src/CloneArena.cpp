@@ -0,0 +1,89 @@
+#include "../include/CloneArena.h"
+
+#include <cstring>
+
+// Clones Walk the Display and Memory as one Run of Pages
+static_assert(offsetof(CHIP8State, memory) == offsetof(CHIP8State, display) + sizeof(CHIP8State::display),
+              "Memory must directly follow the Display");
+
+
+/**
+ * Constructs an Arena whose first Blocks hold the Boot
+ *  Image's Display and Memory Pages, Block N is Page N.
+ *  In XO-CHIP Mode the Boot Memory past 4KB follows
+ *
+ * @param core - Core with the ROM Loaded (Boot Image and Mode are Taken from it)
+ */
+CloneArena::CloneArena(const CHIP8 &core) : used(0), xoBoot(0) {
+    const CHIP8State &boot = core.getBootState();
+    u_int32_t first = allocate(CLONE_PAGES * DIRTY_PAGE_SIZE);
+    memcpy(block(first), boot.display, sizeof(boot.display));
+    memcpy(block(first + CLONE_DISPLAY_PAGES), core.getBootMemory(), MEMORY_SIZE);
+
+    if (core.getMode() == MODE_XO_CHIP) {
+        xoBoot = allocate(CLONE_XO_PAGES * DIRTY_PAGE_SIZE);
+        memcpy(block(xoBoot), core.getBootMemory() + MEMORY_SIZE, XO_MEMORY_SIZE - MEMORY_SIZE);
+    }
+    bootBlocks = used;
+}
+
+/**
+ * Hands out Contiguous Blocks, Starting a new Chunk if the
+ *  Run doesn't fit in what's left of the Current one
+ *
+ * @param bytes - Bytes Needed (at most a Chunk)
+ * @returns Index of the Run's First Block
+ */
+u_int32_t CloneArena::allocate(size_t bytes) {
+    size_t count = (bytes + DIRTY_PAGE_SIZE - 1) / DIRTY_PAGE_SIZE;
+    if (used % CLONE_CHUNK_BLOCKS + count > CLONE_CHUNK_BLOCKS)
+        used += CLONE_CHUNK_BLOCKS - used % CLONE_CHUNK_BLOCKS;
+
+    while ((used + count - 1) / CLONE_CHUNK_BLOCKS >= chunks.size())
+        chunks.emplace_back(new Block[CLONE_CHUNK_BLOCKS]);
+
+    u_int32_t index = u_int32_t(used);
+    used += count;
+    return index;
+}
+
+u_char *CloneArena::block(u_int32_t index) {
+    return chunks[index / CLONE_CHUNK_BLOCKS][index % CLONE_CHUNK_BLOCKS].bytes;
+}
+
+const u_char *CloneArena::block(u_int32_t index) const {
+    return chunks[index / CLONE_CHUNK_BLOCKS][index % CLONE_CHUNK_BLOCKS].bytes;
+}
+
+/**
+ * Frees every Clone at once, their Pointers are Invalid after
+ */
+void CloneArena::clear() {
+    used = bootBlocks;
+}
+
+/**
+ * Grows the Arena up Front so the next count Clones never
+ *  Allocate a Chunk, even if every Page Differs from it's
+ *  Parent. Runs Skipped to a new Chunk waste Fewer Blocks
+ *  than they take, so Twice the Blocks is Enough
+ *
+ * @param count - Clones to make Room for
+ */
+void CloneArena::reserveClones(u_int32_t count) {
+    size_t perClone = (sizeof(CoreClone) + CLONE_PAGES * DIRTY_PAGE_SIZE) / DIRTY_PAGE_SIZE;
+    if (xoBoot)
+        perClone += (CLONE_XO_PAGES * sizeof(u_int32_t)) / DIRTY_PAGE_SIZE + CLONE_XO_PAGES;
+
+    size_t needed = used + 2 * perClone * count;
+    while (chunks.size() * CLONE_CHUNK_BLOCKS < needed)
+        chunks.emplace_back(new Block[CLONE_CHUNK_BLOCKS]);
+}
+
+u_int32_t CloneArena::xoBootBlock() const {
+    return xoBoot;
+}
+
+size_t CloneArena::bytesUsed() const {
+    return used * DIRTY_PAGE_SIZE;
+}
@@ -1,4 +1,6 @@
 #include "../include/Disassembler.h"
+#include <algorithm>
+#include <set>
 #include <sstream>
 using namespace std;
 
@@ -48,259 +50,551 @@ void Disassembler::hexDump(char *filePath, std::ostream &out) {
     }
 }
 
-void Disassembler::disassemble(char *filePath, std::ostream &out) {
-    bool dataSectionFound = false;  // Once Data Section Reached, no more Opcodes
-    stringstream ss;
-    this->hexDump(filePath, ss);
+/**
+ * Reads the ROM's Bytes from the given File
+ *  with a Single Binary Read
+ * 
+ * @param filePath - The Path to the ROM
+ * @param rom - Vector the ROM's Bytes are stored into
+ * @returns False if the File could not be Read
+ */
+bool Disassembler::readROM(char *filePath, vector<u_char> &rom) {
+    ifstream infile(filePath, ios::binary | ios::ate);
 
-    // Format Cout Flags
-    ios_base::fmtflags prevFlags(out.flags());  // To restore Cout Output Style
-    out << hex << uppercase << setw(2) << setfill('0');
+    // Check if file exists
+    if (!infile) {
+        cout << "File not found" << endl;
+        return false;
+    }
 
-    unsigned short PC = 0x200;  // ROM Begins at 0x200
-    unsigned short opcode;      // Instruction Index
-    unsigned short param;       // Opcode's Paramater
-    unsigned short addr;        // Temp Hold Addr/Const
-    while (ss >> opcode) {
-        ss >> param;
-        out << setw(4) << setfill('0') << PC << '\t';
-        out << setw(2) << setfill('0') << opcode << ' ' << setw(2) << setfill('0') << param << '\t';
-
-        // Check if not in Data Section (Opcodes)
-        if (!dataSectionFound) {
-            switch (opcode & 0xF0) {  // Based on the First Nibble
-            case 0x00:                // System Call (SYS addr)
-                addr = ((opcode & 0x0F) << 8) | param;
-
-                if (addr == 0x0E0) {  // Clear Screen (CLS)
-                    out << "CLS";
-                } else if (addr == 0x0EE) {  // Return from Subroutine (RET)
-                    out << "RET";
-                } else {  // Output Data as in on Line
-                    dataSectionFound = true;
-
-                    out << setw(4) << ((opcode << 8) | param);
-                    break;
-                }
-                break;
+    // Size from End Position, then Read Everything at once
+    streamsize size = infile.tellg();
+    rom.resize(size);
+    infile.seekg(0);
+    infile.read((char *)rom.data(), size);
+
+    return bool(infile);
+}
+
+/**
+ * Checks if the given Opcode is a Valid CHIP-8 Instruction
+ *  used to tell Code apart from Data
+ * 
+ * @param opcode - 2 Byte Opcode
+ */
+static bool isInstruction(u_int16_t opcode) {
+    switch (opcode & 0xF000) {
+    case 0x0000:  // CLS, RET, and SUPER-CHIP/XO-CHIP Scrolls/Modes
+        return opcode == 0x00E0 || opcode == 0x00EE || (opcode & 0xFFF0) == 0x00C0 ||
+               (opcode & 0xFFF0) == 0x00D0 || (opcode >= 0x00FB && opcode <= 0x00FF);
+    case 0x5000:  // SE Vx, Vy and XO-CHIP Register Ranges
+        return (opcode & 0xF) <= 0x3 && (opcode & 0xF) != 0x1;
+    case 0x9000:
+        return (opcode & 0xF) == 0x0;
+    case 0x8000:
+        return (opcode & 0xF) <= 0x7 || (opcode & 0xF) == 0xE;
+    case 0xE000:
+        return (opcode & 0xFF) == 0x9E || (opcode & 0xFF) == 0xA1;
+    case 0xF000:
+        switch (opcode & 0xFF) {
+        case 0x00: case 0x02:   // XO-CHIP Long I Load and Audio Pattern (F000/F002 Only)
+            return (opcode & 0x0F00) == 0x0;
+        case 0x01: case 0x3A:
+        case 0x07: case 0x0A: case 0x15: case 0x18: case 0x1E:
+        case 0x29: case 0x30: case 0x33: case 0x55: case 0x65:
+        case 0x75: case 0x85:
+            return true;
+        default:
+            return false;
+        }
+    default:
+        return true;
+    }
+}
+
+/**
+ * Obtains where Control may go after the Instruction
+ * 
+ * @param opcode - 2 Byte Opcode
+ * @param addr - Address of the Instruction
+ * @param next - Opcode after the Instruction, XO-CHIP Skips step over all 4 Bytes of F000 NNNN
+ * @param targets - Branch Targets (Excluding the Fall Through)
+ * @param fallsThrough - Set if Control may continue to the Next Instruction
+ * @returns True if the Instruction Ends a Basic Block
+ */
+static bool controlFlow(u_int16_t opcode, u_int16_t addr, u_int16_t next, vector<u_int16_t> &targets,
+                        bool &fallsThrough) {
+    fallsThrough = true;
+
+    switch (opcode & 0xF000) {
+    case 0x0000:                // RET, EXIT
+        if (opcode != 0x00EE && opcode != 0x00FD) return false;
+        fallsThrough = false;
+        return true;
+
+    case 0x1000:                // JP addr
+    case 0xB000:                // JP V0, addr (Only V0 = 0 is Known)
+        targets.push_back(opcode & 0xFFF);
+        fallsThrough = false;
+        return true;
+
+    case 0x2000:                // CALL addr, Returns to the Next Instruction
+        targets.push_back(opcode & 0xFFF);
+        return true;
+
+    case 0x5000:                // XO-CHIP Register Ranges (5XY2/5XY3) aren't Skips
+        if (opcode & 0xF) return false;
+        // Fall Through
+    case 0x3000:                // Skips, may Continue past the Next Instruction
+    case 0x4000:
+    case 0x9000:
+    case 0xE000:
+        targets.push_back(addr + 0x4);
+        if (next == 0xF000) targets.push_back(addr + 0x6);  // Either, the Analysis doesn't know the Mode
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * Checks if the Address is the Start of a Discovered Instruction
+ * 
+ * @param addr - Address in Memory
+ */
+bool ProgramMap::isCode(u_int16_t addr) const {
+    return addr >= ROM_START && addr < ROM_START + size && byteMap[addr - ROM_START] == BYTE_CODE;
+}
+
+/**
+ * Analyzes the ROM at the given File Path
+ * 
+ * @param filePath - The Path to the ROM
+ */
+ProgramMap Disassembler::analyze(char *filePath) {
+    vector<u_char> rom;
+    readROM(filePath, rom);
+    return analyze(rom.data(), u_int16_t(std::min<size_t>(rom.size(), 0x1000 - ROM_START)));
+}
 
-            case 0x10:  // Jump to Address (JP addr)
-                // NNN = Address
-                addr = ((opcode & 0x0F) << 8) | param;
-                out << "JP " << addr;
+/**
+ * Discovers Code by Recursively Following Control Flow
+ *  (JP, CALL, Skips) from ROM_START, splitting it into
+ *  Basic Blocks. Bytes never reached are Data.
+ * 
+ * @param rom - ROM's Bytes, rom[0] is loaded at ROM_START
+ * @param size - Size of the ROM in Bytes
+ */
+ProgramMap Disassembler::analyze(const u_char *rom, u_int16_t size) {
+    ProgramMap map;
+    map.size = size;
+    map.byteMap.assign(size, BYTE_DATA);
+    map.hasIndirectJump = false;
+
+    set<u_int16_t> leaders = {ROM_START};   // Addresses that Start a Block
+    set<u_int16_t> subroutines;             // CALL Targets
+    vector<u_int16_t> workList = {ROM_START};
+    vector<u_int16_t> targets;
+    bool fallsThrough;
+
+    // Follow every Path until it Leaves the ROM, Reaches
+    //  Known Code, or runs into something that isn't Code
+    while (!workList.empty()) {
+        u_int16_t addr = workList.back();
+        workList.pop_back();
+
+        while (addr >= ROM_START && addr + 1 < ROM_START + size) {
+            u_int16_t offset = addr - ROM_START;
+            if (map.byteMap[offset] != BYTE_DATA || map.byteMap[offset + 1] != BYTE_DATA)
+                break;  // Known Code (or Overlaps it)
+
+            u_int16_t opcode = (rom[offset] << 8) | rom[offset + 1];
+            if (!isInstruction(opcode))
                 break;
 
-            case 0x20:  // Calls Subroutine (CALL addr)
-                // NNN = Address
-                addr = ((opcode & 0x0F) << 8) | param;
-                out << "CALL " << addr;
+            // F000 NNNN is 4 Bytes, the Address Word is it's Operand
+            u_int16_t length = opcode == 0xF000 ? 0x4 : 0x2;
+            if (offset + length > size || (length == 0x4 && (map.byteMap[offset + 2] != BYTE_DATA ||
+                                                              map.byteMap[offset + 3] != BYTE_DATA)))
                 break;
 
-            case 0x30:  // Skip next Instruction if(reg[x] == NN) (SE Vx, byte)
-                out << "SE V" << short(opcode & 0x0F);
+            map.byteMap[offset] = BYTE_CODE;
+            for (u_int16_t i = 1; i < length; i++)
+                map.byteMap[offset + i] = BYTE_OPERAND;
 
-                // Obtain Constant Byte
-                out << ", " << param;
-                break;
+            u_int16_t next = offset + length + 1 < size ? (rom[offset + length] << 8) | rom[offset + length + 1] : 0x0;
+            targets.clear();
+            bool isBranch = controlFlow(opcode, addr, next, targets, fallsThrough);
+            if ((opcode & 0xF000) == 0x2000) subroutines.insert(opcode & 0xFFF);
+            if ((opcode & 0xF000) == 0xB000) map.hasIndirectJump = true;
+
+            for (u_int16_t target : targets) {
+                leaders.insert(target);
+                workList.push_back(target);
+            }
 
-            case 0x40:  // Skip next if (reg[x] != NN) (SNE Vx, byte)
-                out << "SNE V" << short(opcode & 0x0F);
+            addr += length;
+            if (isBranch) leaders.insert(addr);
+            if (!fallsThrough) break;
+        }
+    }
 
-                // Obtain Constant Byte
-                out << ", " << param;
+    // Split Discovered Code into Basic Blocks
+    for (u_int16_t addr = ROM_START; addr < ROM_START + size; addr++) {
+        if (!map.isCode(addr) || !leaders.count(addr))
+            continue;
+
+        BasicBlock block;
+        block.start = addr;
+        block.isSubroutine = subroutines.count(addr);
+
+        stringstream label;
+        label << (block.isSubroutine ? "sub_" : "loc_") << hex << uppercase << addr;
+        block.label = label.str();
+
+        // Extend until Branch, Leader, or End of Code
+        u_int16_t pc = addr;
+        while (true) {
+            u_int16_t opcode = (rom[pc - ROM_START] << 8) | rom[pc - ROM_START + 1];
+            u_int16_t length = opcode == 0xF000 ? 0x4 : 0x2;
+            u_int16_t offset = pc - ROM_START + length;
+            u_int16_t next = offset + 1 < size ? (rom[offset] << 8) | rom[offset + 1] : 0x0;
+            bool isBranch = controlFlow(opcode, pc, next, block.successors, fallsThrough);
+            pc += length;
+
+            if (isBranch || leaders.count(pc) || !map.isCode(pc)) {
+                if (fallsThrough && map.isCode(pc))
+                    block.successors.push_back(pc);
                 break;
+            }
+        }
 
-            case 0x50:  // Skip next if (reg[x] == reg[y]) (SE Vx, Vy)
-                out << "SE V" << short(opcode & 0x0F);
+        block.end = pc;
+        map.blocks[addr] = block;
+    }
 
-                // Obtain next Register Byte
-                out << ", V" << short((0xF0 & param) >> 4);  // Reg[Y] -> 0x5XY0
-                break;
+    return map;
+}
 
-            case 0x60:  // Set reg[x] = NN (LD Vx, byte)
-                out << "LD V" << short(opcode & 0x0F);
+/**
+ * Outputs the Instruction's Mnemonic to given stream
+ * 
+ * @param opcode - High Byte of the Instruction
+ * @param param - Low Byte of the Instruction
+ * @param out - Output Stream for the Mnemonic
+ * @returns False if the Bytes are not an Instruction
+ */
+bool Disassembler::writeInstruction(unsigned short opcode, unsigned short param, std::ostream &out) {
+    unsigned short addr;        // Temp Hold Addr/Const
 
-                // Obtain Constant
-                out << ", " << param;
-                break;
+    switch (opcode & 0xF0) {  // Based on the First Nibble
+    case 0x00:                // System Call (SYS addr)
+        addr = ((opcode & 0x0F) << 8) | param;
+
+        if (addr == 0x0E0) {  // Clear Screen (CLS)
+            out << "CLS";
+        } else if (addr == 0x0EE) {  // Return from Subroutine (RET)
+            out << "RET";
+        } else if ((addr & 0xFF0) == 0x0C0) {  // Scroll Down N Lines (SCD nibble)
+            out << "SCD " << (addr & 0xF);
+        } else if ((addr & 0xFF0) == 0x0D0) {  // Scroll Up N Lines (SCU nibble)
+            out << "SCU " << (addr & 0xF);
+        } else if (addr == 0x0FB) {  // Scroll Right 4 Pixels (SCR)
+            out << "SCR";
+        } else if (addr == 0x0FC) {  // Scroll Left 4 Pixels (SCL)
+            out << "SCL";
+        } else if (addr == 0x0FD) {  // Exit Interpreter (EXIT)
+            out << "EXIT";
+        } else if (addr == 0x0FE) {  // 64x32 Display (LOW)
+            out << "LOW";
+        } else if (addr == 0x0FF) {  // 128x64 Display (HIGH)
+            out << "HIGH";
+        } else {  // Not an Instruction (SYS addr Unsupported)
+            return false;
+        }
+        break;
 
-            case 0x70:  // Adds reg[x] += NN (ADD Vx, byte)
-                out << "ADD V" << short(opcode & 0x0F);
+    case 0x10:  // Jump to Address (JP addr)
+        // NNN = Address
+        addr = ((opcode & 0x0F) << 8) | param;
+        out << "JP " << addr;
+        break;
 
-                // Obtain Constant
-                out << ", " << param;
-                break;
+    case 0x20:  // Calls Subroutine (CALL addr)
+        // NNN = Address
+        addr = ((opcode & 0x0F) << 8) | param;
+        out << "CALL " << addr;
+        break;
 
-            case 0x80:  // Register on Register Operations
-                // Get Operation Type | 8x[y0]
-                switch (param & 0x0F) {  // Operation Type
-                case 0x0:                // Set reg[x] = reg[y]
-                    out << "LD V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-                case 0x1:  // Set reg[x] |= reg[y]
-                    out << "OR V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-                case 0x2:  // Set reg[x] &= reg[y]
-                    out << "AND V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-                case 0x3:  // Set reg[x] ^= reg[y]
-                    out << "XOR V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-                case 0x4:  // Set reg[x] += reg[y]
-                    out << "ADD V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-                case 0x5:  // Set reg[x] -= reg[y]
-                    out << "SUB V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-                case 0x6:  // Shift reg[x] >>= 1
-                    out << "SHR V" << short(opcode & 0x0F);
-                    break;
-
-                case 0x7:  // Set reg[x] = reg[y] - reg[x]
-                    out << "SUBN V" << short(opcode & 0x0F);
-                    out << ", V" << short((param & 0xF0) >> 4);
-                    break;
-
-                case 0xE:  // Shift regx[] <<= 1
-                    out << "SHL V" << short(opcode & 0x0F);
-                    break;
-
-                default:
-                    dataSectionFound = true;
-
-
-                    // Output Data as in on Line
-                    // opcode = (opcode << 8) | addr;
-                    out << setw(4) << ((opcode << 8) | param);
-                    break;
-                }
-                break;
+    case 0x30:  // Skip next Instruction if(reg[x] == NN) (SE Vx, byte)
+        out << "SE V" << short(opcode & 0x0F);
 
-            case 0x90:  // Skip next if (reg[x] != reg[y])
-                out << "SNE V" << short(opcode & 0x0F);
+        // Obtain Constant Byte
+        out << ", " << param;
+        break;
 
-                // Obtain next Register Byte
-                out << ", V" << short(param & 0xF0);
-                break;
+    case 0x40:  // Skip next if (reg[x] != NN) (SNE Vx, byte)
+        out << "SNE V" << short(opcode & 0x0F);
 
-            case 0xA0:  // Set Register I = addr
-                out << "LD I, ";
+        // Obtain Constant Byte
+        out << ", " << param;
+        break;
 
-                // Get Address Annn
-                addr = ((opcode & 0x0F) << 8) | param;
-                out << addr;
-                break;
+    case 0x50:  // Skip next if (reg[x] == reg[y]) (SE Vx, Vy)
+        if ((param & 0x0F) == 0x2) {  // Store reg[x] to reg[y] in mem starting at location I
+            out << "LD [I], V" << short(opcode & 0x0F) << " - V" << short((0xF0 & param) >> 4);
+            break;
+        } else if ((param & 0x0F) == 0x3) {  // Read reg[x] to reg[y] from mem starting at location I
+            out << "LD V" << short(opcode & 0x0F) << " - V" << short((0xF0 & param) >> 4) << ", [I]";
+            break;
+        }
+        out << "SE V" << short(opcode & 0x0F);
 
-            case 0xB0:  // Jumps to location in addr + Reg[0]
-                out << "JP V0, ";
+        // Obtain next Register Byte
+        out << ", V" << short((0xF0 & param) >> 4);  // Reg[Y] -> 0x5XY0
+        break;
 
-                // Get Address Bnnn
-                addr = ((opcode & 0x0F) << 8) | param;
-                out << addr;
-                break;
+    case 0x60:  // Set reg[x] = NN (LD Vx, byte)
+        out << "LD V" << short(opcode & 0x0F);
 
-            case 0xC0:  // Sets reg[x] = byte
-                out << "RND V" << short(opcode & 0x0F);
+        // Obtain Constant
+        out << ", " << param;
+        break;
 
-                // Get Const Byte
-                out << ", " << param;
-                break;
+    case 0x70:  // Adds reg[x] += NN (ADD Vx, byte)
+        out << "ADD V" << short(opcode & 0x0F);
 
-            case 0xD0:  // Draw n-byte sprite at mem (reg[x], reg[y])
-                out << "DRW V" << short(opcode & 0x0F);
+        // Obtain Constant
+        out << ", " << param;
+        break;
 
-                // Get next Byte
-                out << ", V" << short((param & 0xF0) >> 4)  // Vy
-                    << ", " << short(param & 0x0F);         // n
-                break;
+    case 0x80:  // Register on Register Operations
+        // Get Operation Type | 8x[y0]
+        switch (param & 0x0F) {  // Operation Type
+        case 0x0:                // Set reg[x] = reg[y]
+            out << "LD V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
+        case 0x1:  // Set reg[x] |= reg[y]
+            out << "OR V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
+        case 0x2:  // Set reg[x] &= reg[y]
+            out << "AND V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
+        case 0x3:  // Set reg[x] ^= reg[y]
+            out << "XOR V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
+        case 0x4:  // Set reg[x] += reg[y]
+            out << "ADD V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
+        case 0x5:  // Set reg[x] -= reg[y]
+            out << "SUB V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
+        case 0x6:  // Shift reg[x] >>= 1
+            out << "SHR V" << short(opcode & 0x0F);
+            break;
 
-            case 0xE0:  // Skip/No-Skip next Instruction if Key in reg[x] is pressed
-                // Get Next Byte (Skip/No-Skip)
-                if (param == 0x9E) {  // Skip
-                    out << "SKP V" << short(opcode & 0x0F);
-                } else {  // addr == 0xA1 (No Skip)
-                    out << "SKNP V" << short(opcode & 0x0F);
-                }
-                break;
+        case 0x7:  // Set reg[x] = reg[y] - reg[x]
+            out << "SUBN V" << short(opcode & 0x0F);
+            out << ", V" << short((param & 0xF0) >> 4);
+            break;
 
-            case 0xF0:  // Timer | Key Press | Index Register | Sprite
-                // Action Type based on Parameter
-                switch (param) {
-                case 0x07:  // Delay Timer Value by DT
-                    out << "LD V" << short(opcode & 0x0F) << ", DT";
-                    break;
+        case 0xE:  // Shift regx[] <<= 1
+            out << "SHL V" << short(opcode & 0x0F);
+            break;
 
-                case 0x0A:  // Wait for Key Press and store Key in reg[x]
-                    out << "LD V" << short(opcode & 0x0F) << ", K";
-                    break;
+        default:
+            return false;
+        }
+        break;
 
-                case 0x15:  // Set Delay Timer to reg[x]
-                    out << "LD DT, V" << short(opcode & 0x0F);
-                    break;
+    case 0x90:  // Skip next if (reg[x] != reg[y])
+        out << "SNE V" << short(opcode & 0x0F);
 
-                case 0x18:  // Set Sound Timer to reg[x]
-                    out << "LD ST, V" << short(opcode & 0x0F);
-                    break;
+        // Obtain next Register Byte
+        out << ", V" << short((param & 0xF0) >> 4);
+        break;
 
-                case 0x1E:  // Set values of I to reg[x] I += reg[x]
-                    out << "ADD I, V" << short(opcode & 0x0F);
-                    break;
+    case 0xA0:  // Set Register I = addr
+        out << "LD I, ";
 
-                case 0x29:  // Set I to the location of Sprite Digit reg[x]
-                    out << "LD F, V" << short(opcode & 0x0F);
-                    break;
+        // Get Address Annn
+        addr = ((opcode & 0x0F) << 8) | param;
+        out << addr;
+        break;
 
-                case 0x33:  // Store BCD rep of reg[x] in mem locaion I, I+1, and I+2
-                    out << "LD B, V" << short(opcode & 0x0F);
-                    break;
+    case 0xB0:  // Jumps to location in addr + Reg[0]
+        out << "JP V0, ";
 
-                case 0x55:  // Store reg[0] to reg[x] in mem starting at location I
-                    out << "LD [I], V" << short(opcode & 0x0F);
-                    break;
+        // Get Address Bnnn
+        addr = ((opcode & 0x0F) << 8) | param;
+        out << addr;
+        break;
 
-                case 0x65:  // Read reg[0] to reg[x] in mem starting at location I
-                    out << "LD V" << short(opcode & 0x0F)
-                        << ", [I]";
-                    break;
+    case 0xC0:  // Sets reg[x] = byte
+        out << "RND V" << short(opcode & 0x0F);
 
-                default:
-                    dataSectionFound = true;
+        // Get Const Byte
+        out << ", " << param;
+        break;
 
-                    // Output Data as in on Line
-                    out << setw(4) << ((opcode << 8) | param);
-                    break;
-                }
+    case 0xD0:  // Draw n-byte sprite at mem (reg[x], reg[y])
+        out << "DRW V" << short(opcode & 0x0F);
 
+        // Get next Byte
+        out << ", V" << short((param & 0xF0) >> 4)  // Vy
+            << ", " << short(param & 0x0F);         // n
+        break;
 
-                break;
+    case 0xE0:  // Skip/No-Skip next Instruction if Key in reg[x] is pressed
+        // Get Next Byte (Skip/No-Skip)
+        if (param == 0x9E) {  // Skip
+            out << "SKP V" << short(opcode & 0x0F);
+        } else {  // addr == 0xA1 (No Skip)
+            out << "SKNP V" << short(opcode & 0x0F);
+        }
+        break;
+
+    case 0xF0:  // Timer | Key Press | Index Register | Sprite
+        // Action Type based on Parameter
+        switch (param) {
+        case 0x00:  // Set I to the next Word (LD I, long NNNN)
+            out << "LD I, long";
+            break;
 
+        case 0x01:  // Select Drawing Planes n
+            out << "PLANE " << short(opcode & 0x0F);
+            break;
 
+        case 0x02:  // Load 16 Byte Audio Pattern from mem at location I
+            out << "AUDIO";
+            break;
 
-            default:
-                dataSectionFound = true;
+        case 0x07:  // Delay Timer Value by DT
+            out << "LD V" << short(opcode & 0x0F) << ", DT";
+            break;
 
-                // Output Data as in on Line
-                out << setw(4) << ((opcode << 8) | param);
-                break;
+        case 0x0A:  // Wait for Key Press and store Key in reg[x]
+            out << "LD V" << short(opcode & 0x0F) << ", K";
+            break;
+
+        case 0x15:  // Set Delay Timer to reg[x]
+            out << "LD DT, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x18:  // Set Sound Timer to reg[x]
+            out << "LD ST, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x1E:  // Set values of I to reg[x] I += reg[x]
+            out << "ADD I, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x29:  // Set I to the location of Sprite Digit reg[x]
+            out << "LD F, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x30:  // Set I to the location of 8x10 Sprite Digit reg[x]
+            out << "LD HF, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x3A:  // Set Audio Pattern Pitch to reg[x]
+            out << "PITCH V" << short(opcode & 0x0F);
+            break;
+
+        case 0x33:  // Store BCD rep of reg[x] in mem locaion I, I+1, and I+2
+            out << "LD B, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x55:  // Store reg[0] to reg[x] in mem starting at location I
+            out << "LD [I], V" << short(opcode & 0x0F);
+            break;
+
+        case 0x65:  // Read reg[0] to reg[x] in mem starting at location I
+            out << "LD V" << short(opcode & 0x0F)
+                << ", [I]";
+            break;
+
+        case 0x75:  // Store reg[0] to reg[x] in the Flag Registers
+            out << "LD R, V" << short(opcode & 0x0F);
+            break;
+
+        case 0x85:  // Read reg[0] to reg[x] from the Flag Registers
+            out << "LD V" << short(opcode & 0x0F) << ", R";
+            break;
+
+        default:
+            return false;
+        }
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Disassembles given ROM to output stream, using
+ *  Control Flow Analysis to tell Code apart from Data
+ *  so Code following Sprite Data is still Decoded
+ * 
+ * @param filePath - The Path to the ROM
+ * @param out - Output Stream of Disassembly
+ */
+void Disassembler::disassemble(char *filePath, std::ostream &out) {
+    vector<u_char> rom;
+    if (!readROM(filePath, rom)) return;
+    u_int16_t size = u_int16_t(std::min<size_t>(rom.size(), 0x1000 - ROM_START));
+    ProgramMap map = analyze(rom.data(), size);
+
+    // Format Cout Flags
+    ios_base::fmtflags prevFlags(out.flags());  // To restore Cout Output Style
+    out << hex << uppercase;
+
+    unsigned short PC = ROM_START;  // ROM Begins at 0x200
+    while (PC < ROM_START + size) {
+        u_char opcode = rom[PC - ROM_START];
+        u_char param = (PC + 1 < ROM_START + size) ? rom[PC - ROM_START + 1] : 0x00;
+
+        if (map.isCode(PC)) {
+            // Label the Start of Blocks
+            auto block = map.blocks.find(PC);
+            if (block != map.blocks.end())
+                out << '\n' << block->second.label << ":\n";
+
+            out << setw(4) << setfill('0') << PC << '\t';
+            out << setw(2) << setfill('0') << short(opcode) << ' ' << setw(2) << setfill('0') << short(param) << '\t';
+            writeInstruction(opcode, param, out);
+            PC += 0x2;
+
+            // Long Address Word follows F000
+            if (opcode == 0xF0 && param == 0x00 && PC + 1 < ROM_START + size) {
+                out << ' ' << setw(4) << setfill('0') << ((rom[PC - ROM_START] << 8) | rom[PC - ROM_START + 1]);
+                PC += 0x2;
             }
-        } else {  // Data Section Reached
-                  // Output Data as in on Line
+        } else if (PC + 1 < ROM_START + size && !map.isCode(PC + 1)) {  // Data Word
+            out << setw(4) << setfill('0') << PC << '\t';
+            out << setw(2) << setfill('0') << short(opcode) << ' ' << setw(2) << setfill('0') << short(param) << '\t';
             out << setw(4) << ((opcode << 8) | param);
+            PC += 0x2;
+        } else {  // Single Data Byte before Unaligned Code
+            out << setw(4) << setfill('0') << PC << '\t';
+            out << setw(2) << setfill('0') << short(opcode) << "   \t";
+            out << setw(2) << short(opcode);
+            PC += 0x1;
         }
 
-        // Keep track of PC Line
-        PC += 0x2;
-        if (!(PC % 0x10)) out << '\n';
-
         out << '\n';
     }
 
     // Restore out Flags
     out.flags(prevFlags);
-}
\ No newline at end of file
+}
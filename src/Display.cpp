@@ -47,370 +47,509 @@ std::string int_to_hex(T i) {
 
 
 void Display::Draw() {
-    // Keep Track of Last Draw
-    static u_int32_t startTime = SDL_GetTicks();
+    FrameTrace::Time frameStart = FrameTrace::now();
+
+    // Present at most once per 60Hz Tick (VBlank)
+    //  Audio Clocked Runs leave Pacing to VSync alone
+    if (!isAudioClocked) {
+        const std::chrono::microseconds frameTime(1000000 / 60);
+        std::this_thread::sleep_until(nextPresent);
+        nextPresent += frameTime;
+        if (nextPresent < std::chrono::steady_clock::now())   // Fell Behind, don't try to Catch Up
+            nextPresent = std::chrono::steady_clock::now() + frameTime;
+        traceSpan(TRACE_WAIT, TRACE_THREAD_RENDER, frameStart);
+    }
 
-    // Output FPS to Window Title
-    sprintf(titleBuffer, "%s [%.2f FPS]", title, getFPS());
+    // Output FPS to Window Title, Input Latency once Presses are Measured
+    if (isLatencyProbed && latency.getCount() != latencyShown) {
+        latencyShown = latency.getCount();
+        latency.summary(latencyText, sizeof(latencyText));
+    }
+    if (latencyText[0]) sprintf(titleBuffer, "%s [%.2f FPS] [%s]", title, getFPS(), latencyText);
+    else sprintf(titleBuffer, "%s [%.2f FPS]", title, getFPS());
     SDL_SetWindowTitle(window, titleBuffer);
 
-    // Draw at Specified Rate
-    for (int _spdCount = 0; _spdCount < drawRate; _spdCount++) {
-        // Redraw ONLY if Draw Flag Flipped
-        if(cpu->drawFlag) {
-            // Preconfigure Rendering & Texture
-            SDL_SetRenderTarget(renderer, texture);                     // Set Rendering Target to use
-            SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0x00);   // Set Render Draw Color (For Black Clear)
-            SDL_RenderClear(renderer);                                  // Clear Renderer (Black)
-            
-            // Handle Pixles
-            manipPixels(texture, [&](uint32_t *pixels) {
-                for (int x = 0; x < 64; x++)
-                    for (int y = 0; y < 32; y++)
-                        drawPixel(x, y, cpu->display[x][y] ? 0xFFFFFF : 0x00, pixels);
-            });
-
-            
-            // Draw Texture on entire Window (Depending on Debug or Not)
-            SDL_RenderCopy(renderer, texture, nullptr, isDebugMode ? &drawArea : nullptr);
-
-            // Sets the Behind te Scenes to be viewed (DRAW CALL)
-            SDL_RenderPresent(renderer);
-            
-
-            // Unswitch
-            cpu->drawFlag = false;
-        }
-
-
-        // Draw Debug Menu on Textures
-        // Keys:
-        //  F1 = Step Through
-        //  F2 = Loop Toggle
-        if(isDebugMode) {
-            // Setup Texture for all Debug Output
-            manipPixels(debugTexture, [&](uint32_t *pixels) {                   // Apply Buffer to Texture
-                for (int y =0; y<debugArea.h; y++)
-                    for(int x =0; x<debugArea.w; x++)
-                        pixels[x + debugArea.w * y] = debugBuffer[x + debugArea.w * y] ? 0xAAAAAA : 0x00;
-            });
-
-
-            // Obtain Instructions from Stream
-            //  Storing only 10 Instructions & Clearing Stream
-            if(out->str().length()) {
-                this->instructionWindow.push_front(out->str());         // Store Instructions in a Queue
-                if (this->instructionWindow.size() > 20)                // Keep 20 Instructions ONLY
-                    this->instructionWindow.pop_back();
-                out->str( "" );                                         // Clear Stream
-            }
-            
-            
-            static TTF_Font *font = TTF_OpenFont("../res/fonts/InputMono-Regular.ttf", 24);
-            if(font) {
-                SDL_RenderCopy(renderer, debugTexture, nullptr, &debugArea); // Draw Debug Texture Area (Clearing the Window)
+    // Run-Ahead Overhead, Measured on the CPU or Audio Thread
+    uint64_t report = runAheadReport.exchange(0, std::memory_order_relaxed);
+    if (report)
+        spdlog::info("Display::runAhead: {} Frames Ahead, {:.3f}ms per Frame Overhead (Max {:.3f}ms)",
+                     runAheadFrames, (report >> 32) / 1e6, (report & 0xFFFFFFFF) / 1e6);
+
+    // Upload ONLY if CPU Thread Published a new Frame since last Tick
+    //  any number of DRWs in between are Coalesced into one Present
+    bool isNewFrame = frames.update();
+    u_int32_t latencyTag = 0;
+    if (isNewFrame) {
+        const Frame &frame = frames.readBuffer();
+        latencyTag = frame.latencyTag;
+
+        // Handle Pixles, every Plane Composited in one Pass
+        FrameTrace::Time convertStart = FrameTrace::now();
+        isHiresShown = frame.hires;
+        manipPixels(isHiresShown ? hiresTexture : texture, [&](uint32_t *pixels) {
+            compositeDisplay(frame.display, frame.hires, palette, pixels);
+        });
+        traceSpan(TRACE_CONVERT, TRACE_THREAD_RENDER, convertStart);
+    }
 
-                // Store Backup of Area
-                int h = debugArea.h;
-                int w = debugArea.w;
-                int x = debugArea.x;
-                int y = debugArea.y;
+    // Nothing Changed, keep Last Presented Frame
+    //  (Audio Clocked Runs Present anyway, VSync is their only Wait)
+    if (!isNewFrame && !isDebugMode && !isAudioClocked) {
+        traceSpan(TRACE_FRAME, TRACE_THREAD_RENDER, frameStart);
+        return;
+    }
 
+    // Preconfigure Rendering
+    SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0x00);   // Set Render Draw Color (For Black Clear)
+    SDL_RenderClear(renderer);                                  // Clear Renderer (Black)
 
-                // Draw Registers
-                {
-                    // Offset
-                    debugArea.x += 2;
-                    debugArea.y += 6;
-                    
+    // Draw Texture on entire Window (Depending on Debug or Not)
+    SDL_RenderCopy(renderer, isHiresShown ? hiresTexture : texture, nullptr, isDebugMode ? &drawArea : nullptr);
 
-                    // Set Area Dimensions
-                    debugArea.h = 14;
-                    debugArea.w = 64;
 
+    // Draw Debug Menu on Textures
+    // Keys:
+    //  F1 = Step Through
+    //  F2 = Loop Toggle
+    FrameTrace::Time overlayStart = FrameTrace::now();
+    if(isDebugMode) {
+        // CPU Thread is Stepping, keep State still while Reading
+        std::lock_guard<std::mutex> lock(cpuMutex);
+
+        // Setup Texture for all Debug Output
+        manipPixels(debugTexture, [&](uint32_t *pixels) {                   // Apply Buffer to Texture
+            for (int y =0; y<debugArea.h; y++)
+                for(int x =0; x<debugArea.w; x++)
+                    pixels[x + debugArea.w * y] = debugBuffer[x + debugArea.w * y] ? 0xAAAAAA : 0x00;
+        });
+
+
+        // Obtain Instructions from Stream
+        //  Storing only 10 Instructions & Clearing Stream
+        if(out->str().length()) {
+            this->instructionWindow.push_front(out->str());         // Store Instructions in a Queue
+            if (this->instructionWindow.size() > 20)                // Keep 20 Instructions ONLY
+                this->instructionWindow.pop_back();
+            out->str( "" );                                         // Clear Stream
+        }
+        
+        
+        static TTF_Font *font = TTF_OpenFont("../res/fonts/InputMono-Regular.ttf", 24);
+        if(font) {
+            SDL_RenderCopy(renderer, debugTexture, nullptr, &debugArea); // Draw Debug Texture Area (Clearing the Window)
+
+            // Store Backup of Area
+            int h = debugArea.h;
+            int w = debugArea.w;
+            int x = debugArea.x;
+            int y = debugArea.y;
+
+
+            // Draw Registers
+            {
+                // Offset
+                debugArea.x += 2;
+                debugArea.y += 6;
+                
 
-                    for (int i =0; i<=0xF; i++) {
-                        char *textBuffer = new char[255];
-                        sprintf(textBuffer, "V%X = %X", i, cpu->getRegisterVal(i));
-                        SDL_Surface *surf = TTF_RenderText_Solid(font, textBuffer, {255, 255, 255, 255});
-                        SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+                // Set Area Dimensions
+                debugArea.h = 14;
+                debugArea.w = 64;
 
-                        debugArea.y += 14;
-                        SDL_RenderCopy(renderer, tex, nullptr, &debugArea);
 
-                        // Free Memory
-                        SDL_FreeSurface(surf);
-                        SDL_DestroyTexture(tex);
-                        delete[] textBuffer;
-                    }
+                for (int i =0; i<=0xF; i++) {
+                    char *textBuffer = new char[255];
+                    sprintf(textBuffer, "V%X = %X", i, cpu->getRegisterVal(i));
+                    SDL_Surface *surf = TTF_RenderText_Solid(font, textBuffer, {255, 255, 255, 255});
+                    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
 
+                    debugArea.y += 14;
+                    SDL_RenderCopy(renderer, tex, nullptr, &debugArea);
 
-                    // Restore Area Properties
-                    debugArea.h = h;
-                    debugArea.w = w;
-                    debugArea.x = x;
-                    debugArea.y = y;
+                    // Free Memory
+                    SDL_FreeSurface(surf);
+                    SDL_DestroyTexture(tex);
+                    delete[] textBuffer;
                 }
 
 
-                // Draw Keys
-                {
-                    // Offset
-                    debugArea.x += 88;
-                    debugArea.y += 6;
-
-                    // Set Area Dimensions
-                    debugArea.h = 14;
-                    debugArea.w = 64;
-
-                    for (int i =0; i<=0xF; i++) {
-                        char *textBuffer = new char[255];
-                        sprintf(textBuffer, "K%X = %X", i, cpu->key[i]);
-                        SDL_Surface *surf = TTF_RenderText_Solid(font, textBuffer, {255, 255, 255, 255});
-                        SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
-
-                        debugArea.y += 14;
-                        SDL_RenderCopy(renderer, tex, nullptr, &debugArea);
-
-                        // Free Memory
-                        SDL_FreeSurface(surf);
-                        SDL_DestroyTexture(tex);
-                        delete[] textBuffer;
-                    }
-
-                    // Restore Area Properties
-                    debugArea.h = h;
-                    debugArea.w = w;
-                    debugArea.x = x;
-                    debugArea.y = y;
-                }
-                
+                // Restore Area Properties
+                debugArea.h = h;
+                debugArea.w = w;
+                debugArea.x = x;
+                debugArea.y = y;
+            }
 
-                // Draw Instruction Window
-                {
-                    // Store Prev Values (In Scope)
-                    int w = instrArea.w;
-                    int h = instrArea.h;
-                    int x = instrArea.x;
-                    int y = instrArea.y;
-
-                    // Clear Window
-                    SDL_Surface *s = SDL_CreateRGBSurface(0, w, h, 32, 0, 0, 0, 0);
-                    SDL_Texture *t = SDL_CreateTextureFromSurface(renderer, s);
-                    SDL_RenderCopy(renderer, t, nullptr, &instrArea); // Draw Debug Texture Area
-                    SDL_FreeSurface(s);
-                    SDL_DestroyTexture(t);
-
-
-                    // Apply the Instructions from Queue
-                    for (size_t i = 0;
-                        (i < this->instructionWindow.size()) && (i < 11);
-                        i++) {
-                            
-                        // Get Instruction
-                        const std::string &instr = this->instructionWindow[i];
-
-
-                        // Set Area Dimensions based on String
-                        instrArea.h = 16;                  // 16px Tall
-                        instrArea.w = instr.length() * 9;  // 9px Per Character
-
-                        // Offset
-                        // instrArea.x += 155;
-                        instrArea.y += instrArea.h;
-
-
-                        // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
-                        SDL_Surface *surf = TTF_RenderText_Solid(
-                            font,
-                            instr.c_str(),
-                            i ? SDL_Color({255, 255, 255, 255}) : SDL_Color({255, 51, 116, 255}));
-                        SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
-
-
-                        // Apply Texture
-                        SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
-
-                        // Free Memory
-                        SDL_FreeSurface(surf);
-                        SDL_DestroyTexture(tex);
-                    }
-
-                    // Restore Area Properties
-                    instrArea.h = h;
-                    instrArea.w = w;
-                    instrArea.x = x;
-                    instrArea.y = y;
-                }
 
+            // Draw Keys
+            {
+                // Offset
+                debugArea.x += 88;
+                debugArea.y += 6;
 
-                // Draw PC, I, Timers
-                {
-                    // Store Prev Values (In Scope)
-                    int w = instrArea.w;
-                    int h = instrArea.h;
-                    int x = instrArea.x;
-                    int y = instrArea.y;
+                // Set Area Dimensions
+                debugArea.h = 14;
+                debugArea.w = 64;
 
-                    // Offset
-                    instrArea.x += 265;
-                    instrArea.y += 16;
-
-                    // Assign Program Counter
-                    std::string str = "PC = " + int_to_hex(cpu->getProgramCounter());
+                for (int i =0; i<=0xF; i++) {
+                    char *textBuffer = new char[255];
+                    sprintf(textBuffer, "K%X = %X", i, cpu->key[i]);
+                    SDL_Surface *surf = TTF_RenderText_Solid(font, textBuffer, {255, 255, 255, 255});
+                    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
 
-                    // Set Area Dimensions based on String
-                    instrArea.h = 16;                  // 16px Tall
-                    instrArea.w = str.length() * 9;  // 9px Per Character
+                    debugArea.y += 14;
+                    SDL_RenderCopy(renderer, tex, nullptr, &debugArea);
 
-                    // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
-                    // Apply Texture
                     // Free Memory
-                    SDL_Surface *surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
-                    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
-                    SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
                     SDL_FreeSurface(surf);
                     SDL_DestroyTexture(tex);
+                    delete[] textBuffer;
+                }
 
+                // Restore Area Properties
+                debugArea.h = h;
+                debugArea.w = w;
+                debugArea.x = x;
+                debugArea.y = y;
+            }
+            
 
-                    // Offset
-                    instrArea.y += 16;
+            // Draw Instruction Window
+            {
+                // Store Prev Values (In Scope)
+                int w = instrArea.w;
+                int h = instrArea.h;
+                int x = instrArea.x;
+                int y = instrArea.y;
+
+                // Clear Window
+                SDL_Surface *s = SDL_CreateRGBSurface(0, w, h, 32, 0, 0, 0, 0);
+                SDL_Texture *t = SDL_CreateTextureFromSurface(renderer, s);
+                SDL_RenderCopy(renderer, t, nullptr, &instrArea); // Draw Debug Texture Area
+                SDL_FreeSurface(s);
+                SDL_DestroyTexture(t);
+
+
+                // Apply the Instructions from Queue
+                for (size_t i = 0;
+                    (i < this->instructionWindow.size()) && (i < 11);
+                    i++) {
+                        
+                    // Get Instruction
+                    const std::string &instr = this->instructionWindow[i];
 
-                    // Assign Index Register
-                    str = "I  = " + int_to_hex(cpu->getIndexReg());
 
                     // Set Area Dimensions based on String
                     instrArea.h = 16;                  // 16px Tall
-                    instrArea.w = str.length() * 9;  // 9px Per Character
+                    instrArea.w = instr.length() * 9;  // 9px Per Character
+
+                    // Offset
+                    // instrArea.x += 155;
+                    instrArea.y += instrArea.h;
+
 
                     // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
+                    SDL_Surface *surf = TTF_RenderText_Solid(
+                        font,
+                        instr.c_str(),
+                        i ? SDL_Color({255, 255, 255, 255}) : SDL_Color({255, 51, 116, 255}));
+                    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+
+
                     // Apply Texture
-                    // Free Memory
-                    surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
-                    tex = SDL_CreateTextureFromSurface(renderer, surf);
                     SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
+
+                    // Free Memory
                     SDL_FreeSurface(surf);
                     SDL_DestroyTexture(tex);
+                }
 
+                // Restore Area Properties
+                instrArea.h = h;
+                instrArea.w = w;
+                instrArea.x = x;
+                instrArea.y = y;
+            }
 
-                    // Offset
-                    instrArea.y += 16;
-
-                    // Assign Delay Timer
-                    str = "DT = " + int_to_hex(u_int16_t(cpu->get_dTimer()));
 
-                    // Set Area Dimensions based on String
-                    instrArea.h = 16;                  // 16px Tall
-                    instrArea.w = str.length() * 9;  // 9px Per Character
+            // Draw PC, I, Timers
+            {
+                // Store Prev Values (In Scope)
+                int w = instrArea.w;
+                int h = instrArea.h;
+                int x = instrArea.x;
+                int y = instrArea.y;
+
+                // Offset
+                instrArea.x += 265;
+                instrArea.y += 16;
+
+                // Assign Program Counter
+                std::string str = "PC = " + int_to_hex(cpu->getProgramCounter());
+
+                // Set Area Dimensions based on String
+                instrArea.h = 16;                  // 16px Tall
+                instrArea.w = str.length() * 9;  // 9px Per Character
+
+                // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
+                // Apply Texture
+                // Free Memory
+                SDL_Surface *surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
+                SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+                SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
+                SDL_FreeSurface(surf);
+                SDL_DestroyTexture(tex);
+
+
+                // Offset
+                instrArea.y += 16;
+
+                // Assign Index Register
+                str = "I  = " + int_to_hex(cpu->getIndexReg());
+
+                // Set Area Dimensions based on String
+                instrArea.h = 16;                  // 16px Tall
+                instrArea.w = str.length() * 9;  // 9px Per Character
+
+                // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
+                // Apply Texture
+                // Free Memory
+                surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
+                tex = SDL_CreateTextureFromSurface(renderer, surf);
+                SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
+                SDL_FreeSurface(surf);
+                SDL_DestroyTexture(tex);
+
+
+                // Offset
+                instrArea.y += 16;
+
+                // Assign Delay Timer
+                str = "DT = " + int_to_hex(u_int16_t(cpu->get_dTimer()));
+
+                // Set Area Dimensions based on String
+                instrArea.h = 16;                  // 16px Tall
+                instrArea.w = str.length() * 9;  // 9px Per Character
+
+                // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
+                // Apply Texture
+                // Free Memory
+                surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
+                tex = SDL_CreateTextureFromSurface(renderer, surf);
+                SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
+                SDL_FreeSurface(surf);
+                SDL_DestroyTexture(tex);
+
+
+                // Offset
+                instrArea.y += 16;
+
+                // Assign Sound Timer
+                str = "ST = " + int_to_hex(u_int16_t(cpu->get_sTimer()));
+
+                // Set Area Dimensions based on String
+                instrArea.h = 16;                  // 16px Tall
+                instrArea.w = str.length() * 9;  // 9px Per Character
+
+                // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
+                // Apply Texture
+                // Free Memory
+                surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
+                tex = SDL_CreateTextureFromSurface(renderer, surf);
+                SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
+                SDL_FreeSurface(surf);
+                SDL_DestroyTexture(tex);
+
+
+                // Restore Area Properties
+                instrArea.h = h;
+                instrArea.w = w;
+                instrArea.x = x;
+                instrArea.y = y;
+            }
+            
 
-                    // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
-                    // Apply Texture
-                    // Free Memory
-                    surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
-                    tex = SDL_CreateTextureFromSurface(renderer, surf);
-                    SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
-                    SDL_FreeSurface(surf);
-                    SDL_DestroyTexture(tex);
+            // Draw Values at mem[I], mem[I+1], mem[I+2]
+            {
+                // Store Prev Values (In Scope)
+                int w = instrArea.w;
+                int h = instrArea.h;
+                int x = instrArea.x;
+                int y = instrArea.y;
 
+                // Offset
+                instrArea.x += 415;
 
-                    // Offset
-                    instrArea.y += 16;
+                // Set Area Dimensions based on String
+                instrArea.h = 16;                  // 16px Tall
 
-                    // Assign Sound Timer
-                    str = "ST = " + int_to_hex(u_int16_t(cpu->get_sTimer()));
 
-                    // Set Area Dimensions based on String
-                    instrArea.h = 16;                  // 16px Tall
+                // Obtain and Display Memory Location Values
+                std::string str;
+                for (u_int16_t i=0; i<11; i++) {
+                    // Construct Result in a String
+                    //  align for OCD :)
+                    str = "mem[I+" + std::to_string(i) + (i < 10 ? " " : "") + "]=" + int_to_hex(u_int16_t(cpu->getMemVal(cpu->getIndexReg() + i)));
+                    
+                    // Offset & Set Size of String
                     instrArea.w = str.length() * 9;  // 9px Per Character
+                    instrArea.y += 16;
 
-                    // Create Text as Texture, WHITE=INSTR | PINK=CURR_INSTR
-                    // Apply Texture
-                    // Free Memory
-                    surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
-                    tex = SDL_CreateTextureFromSurface(renderer, surf);
+                    // Draw & Render
+                    SDL_Surface *surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
+                    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
                     SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
                     SDL_FreeSurface(surf);
                     SDL_DestroyTexture(tex);
-
-
-                    // Restore Area Properties
-                    instrArea.h = h;
-                    instrArea.w = w;
-                    instrArea.x = x;
-                    instrArea.y = y;
                 }
-                
 
-                // Draw Values at mem[I], mem[I+1], mem[I+2]
-                {
-                    // Store Prev Values (In Scope)
-                    int w = instrArea.w;
-                    int h = instrArea.h;
-                    int x = instrArea.x;
-                    int y = instrArea.y;
 
-                    // Offset
-                    instrArea.x += 415;
+                // Restore Area Properties
+                instrArea.h = h;
+                instrArea.w = w;
+                instrArea.x = x;
+                instrArea.y = y;
+            }
+            
+            
+        } else {
+            spdlog::error("Display::Draw: Font Open Failed! Switching off Debug Mode");
+            isDebugMode = false;
+        }
+        traceSpan(TRACE_OVERLAY, TRACE_THREAD_RENDER, overlayStart);
+    }
 
-                    // Set Area Dimensions based on String
-                    instrArea.h = 16;                  // 16px Tall
+    // Sets the Behind te Scenes to be viewed (Single DRAW CALL per Tick)
+    FrameTrace::Time presentStart = FrameTrace::now();
+    SDL_RenderPresent(renderer);
+    traceSpan(TRACE_PRESENT, TRACE_THREAD_RENDER, presentStart);
+    if (latencyTag) latency.onPresent(latencyTag);
+    traceSpan(TRACE_FRAME, TRACE_THREAD_RENDER, frameStart);
+}
 
+/**
+ * Runs one Frame, stepping drawRate Instructions and
+ *  Publishing the Display once the Frame is Complete.
+ *  Called from the CPU Thread, or the Audio Thread when
+ *  the Audio Device is the Clock
+ * 
+ * @param userdata - Pointer to the Display to access Data
+ */
+void Display::emulateFrame(void *userdata) {
+    Display *parent = static_cast<Display *>(userdata);
+    CHIP8 *cpu = parent->cpu;
+
+    FrameTrace::Time cpuStart = FrameTrace::now();
+    bool isDebugMode = parent->isDebugMode;  // Read once, the Render Thread may Clear it mid-Frame
+    {
+        // Only Contended by the Debug Menu
+        std::unique_lock<std::mutex> lock(parent->cpuMutex, std::defer_lock);
+        if (isDebugMode) lock.lock();
+
+        // Keys Held as the Frame Starts, Late Input Latches them per Read instead
+        if (!parent->isLateInput) {
+            u_int16_t mask = parent->keyMask.load(std::memory_order_relaxed);
+            for (u_char i = 0x0; i <= 0xF; i++)
+                cpu->key[i] = (mask >> i) & 0x1;
+        }
 
-                    // Obtain and Display Memory Location Values
-                    std::string str;
-                    for (u_int16_t i=0; i<11; i++) {
-                        // Construct Result in a String
-                        //  align for OCD :)
-                        str = "mem[I+" + std::to_string(i) + (i < 10 ? " " : "") + "]=" + int_to_hex(u_int16_t(cpu->getMemVal(cpu->getIndexReg() + i)));
-                        
-                        // Offset & Set Size of String
-                        instrArea.w = str.length() * 9;  // 9px Per Character
-                        instrArea.y += 16;
-
-                        // Draw & Render
-                        SDL_Surface *surf = TTF_RenderText_Solid(font, str.c_str(), {255, 255, 255, 255});
-                        SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
-                        SDL_RenderCopy(renderer, tex, nullptr, &instrArea);
-                        SDL_FreeSurface(surf);
-                        SDL_DestroyTexture(tex);
-                    }
-
-
-                    // Restore Area Properties
-                    instrArea.h = h;
-                    instrArea.w = w;
-                    instrArea.x = x;
-                    instrArea.y = y;
+        // Run CHIP8 at Specified Rate
+        //  Debug Mode runs through CHIP8::run for Instruction Output
+        if (!isDebugMode) {
+            if (parent->isLoop) cpu->step(parent->drawRate);
+        } else {
+            for (int _spdCount = 0; _spdCount < parent->drawRate; _spdCount++) {
+                if (parent->isLoop || parent->isStep) {
+                    cpu->run(true);
+                    parent->isStep = false;
                 }
-                
-                
-            } else {
-                spdlog::error("Display::Draw: Font Open Failed! Switching off Debug Mode");
-                isDebugMode = false;
             }
-
-            // DRAW CALL
-            SDL_RenderPresent(renderer);
         }
+    }
+    parent->traceSpan(TRACE_CPU, TRACE_THREAD_CPU, cpuStart);
+
+    // Buzzer follows the Sound Timer (Lock-Free), XO-CHIP ROMs Supply their own Pattern
+    //  A Tone that Ran Out within the Frame still Sounds for it (soundFlag)
+    if (cpu->getMode() == MODE_XO_CHIP)
+        parent->audio.setPattern(cpu->getState().pattern, cpu->getState().pitch);
+    parent->audio.setSoundTimer(cpu->isSoundOn());
+    cpu->soundFlag = false;
+
+    // Run-Ahead Presents the Future instead (Not while Debugging or Paused)
+    if (parent->runAheadFrames && !isDebugMode && parent->isLoop) {
+        parent->runAhead();
+        return;
+    }
 
+    // Publish Completed Frame ONLY if Draw Flag Flipped
+    if (cpu->drawFlag)
+        parent->publishFrame();
+}
 
-        // Run CHIP8
-        if(isLoop || isStep) {
-            cpu->run(true);
-            isStep = false;
-        }
+/**
+ * Publishes the CPU's Display as a Completed Frame
+ */
+void Display::publishFrame() {
+    Frame &frame = frames.writeBuffer();
+    memcpy(frame.display, cpu->getState().display, sizeof(Frame::display));
+    frame.hires = cpu->isHires();
+    frame.latencyTag = isLatencyProbed ? latency.onPublish() : 0;
+    frames.publish();
+    cpu->drawFlag = false;
+}
 
-        // NOTE: A small Patch, but not entirely Accurate :(
-        // Slow Down Draw (60FPS)
-        u_int32_t dTime = SDL_GetTicks() - startTime;       // Get the time it took to go through Draw
+/**
+ * Run-Ahead, Hides the ROM's own Input Lag: Saves the Real State,
+ *  Emulates runAheadFrames more Frames Holding the Current Keys,
+ *  Publishes that Frame, then Restores the Real State. Overhead
+ *  is Reported every RUN_AHEAD_REPORT Frames
+ */
+void Display::runAhead() {
+    auto start = std::chrono::steady_clock::now();
+
+    // Clones share Unchanged Pages with the Boot Image, the Arena
+    //  was Reserved for one so this never Allocates (Audio Thread)
+    const CoreClone *saved = cpu->clone(*runAheadArena);
+
+    for (int frame = 0; frame < runAheadFrames; frame++)
+        cpu->step(drawRate);
+    publishFrame();
+
+    cpu->restore(*runAheadArena, saved);
+    runAheadArena->clear();
+    cpu->drawFlag = false;
+    cpu->soundFlag = false;  // Frames Ahead don't Sound
+    traceSpan(TRACE_RUN_AHEAD, TRACE_THREAD_CPU, start);
+
+    // Overhead Report, Logged by the Render Thread
+    uint64_t elapsed = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    runAheadTotal += elapsed;
+    runAheadMax = std::max(runAheadMax, elapsed);
+    if (++runAheadCount == RUN_AHEAD_REPORT) {
+        uint64_t average = std::min<uint64_t>(runAheadTotal / runAheadCount, 0xFFFFFFFF);
+        runAheadReport.store((average << 32) | std::min<uint64_t>(runAheadMax, 0xFFFFFFFF), std::memory_order_relaxed);
+        runAheadTotal = runAheadMax = 0;
+        runAheadCount = 0;
+    }
+}
 
-        if(dTime < (1000/60/drawRate)) {                             // Limit to 60FPS
-            std::this_thread::sleep_for(std::chrono::milliseconds( u_int64_t((1000 / 60 / drawRate) ) - dTime) );
-        }else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000 / 60 / drawRate));
-        }
+/**
+ * CPU Thread, runs the CHIP8 at a Fixed 60Hz Frame Rate
+ *  off the System Clock
+ * 
+ * @param parent - Pointer to the Display to access Data
+ */
+void Display::handleCPU(Display *parent) {
+    const std::chrono::microseconds frameTime(1000000 / 60);
+    auto nextFrame = std::chrono::steady_clock::now();
 
-        startTime = SDL_GetTicks();
+    while (parent->isRunning) {
+        emulateFrame(parent);
+
+        // Wait for next Frame
+        nextFrame += frameTime;
+        std::this_thread::sleep_until(nextFrame);
     }
 }
 
@@ -487,6 +626,12 @@ void Display::Preload() {
         SDL_TEXTUREACCESS_STREAMING,
         WIDTH,
         HEIGHT);
+    hiresTexture = SDL_CreateTexture(
+        renderer,
+        SDL_PIXELFORMAT_RGB888,
+        SDL_TEXTUREACCESS_STREAMING,
+        DISPLAY_HIRES_WIDTH,
+        DISPLAY_HIRES_HEIGHT);
 
     // Setup Debug Texture
     debugTexture = SDL_CreateTexture(
@@ -507,8 +652,15 @@ void Display::onKey(SDL_KeyboardEvent &key) {
     if (key.state == SDL_PRESSED || key.state == SDL_RELEASED) {
         // Set Key Value
         for (u_char i = 0x0; i <= 0xF; i++) {
-            if (key.keysym.sym == keyMap[i])
-                cpu->key[i] = (key.state == SDL_PRESSED);  // Set CPU's Key to Position Pressed
+            if (key.keysym.sym != keyMap[i]) continue;
+
+            // Publish the Key, the CPU Thread Copies it into cpu->key each Frame (or Latches it Late)
+            if (key.state == SDL_PRESSED) keyMask |= u_int16_t(0x1 << i);
+            else keyMask &= u_int16_t(~(0x1 << i));
+
+            // Follow the Press through to the Screen (Key Repeats aren't Presses)
+            if (isLatencyProbed && key.state == SDL_PRESSED && !key.repeat)
+                latency.onPress(i);
         }
 
         // Debug Keys
@@ -519,6 +671,7 @@ void Display::onKey(SDL_KeyboardEvent &key) {
                 else if (key.keysym.sym == SDLK_F2) // Toggle Loop
                     isLoop = !isLoop;
                 else if (key.keysym.sym == SDLK_F3) { // Dump Memory to file called memory.dump
+                    std::lock_guard<std::mutex> lock(cpuMutex);
                     std::ofstream dumpFile("memory.dump", std::ios::out);
                     cpu->memDump(dumpFile);
                     dumpFile.close();
@@ -540,7 +693,15 @@ Display::Display(CHIP8 *chip8, u_int8_t upscale) : SimpleRender(upscale, "YAC8")
     // Initial Values
     isLoop = true;
     isStep = false;
+    isRunning = false;
+    isAudioPaced = false;
+    isAudioClocked = false;
+    keyMask = 0x0;
+    runAheadReport = 0;
+    isLateInput = false;
+    isLatencyProbed = false;
     drawRate = DRAW_RATE;
+    nextPresent = std::chrono::steady_clock::now();
 }
 
 /**
@@ -551,6 +712,7 @@ Display::~Display() {
     // Clean up Debug Data
     delete[] debugBuffer;
     SDL_DestroyTexture(debugTexture);
+    SDL_DestroyTexture(hiresTexture);
     if(this->out) delete out;
 
     // TrueType Done :0
@@ -561,7 +723,46 @@ Display::~Display() {
  * Main Display Run Loop
  */
 void Display::run() {
+    // Audio Device Clocks the CPU if Asked (Not while Debugging, the
+    //  Debug Menu Locks the CPU), Otherwise CPU runs on it's own Thread
+    if (isAudioPaced && !isDebugMode)
+        audio.setFrameCallback(emulateFrame, this);
+    isAudioClocked = audio.open() && isAudioPaced && !isDebugMode;  // Buzzer | Runs Silent without a Device
+    if (isAudioPaced && !isAudioClocked)
+        spdlog::warn("Display::run: Audio Pacing Unavailable, Pacing off the System Clock");
+
+    // Render Loop only Presents
+    isRunning = true;
+    std::thread cpu_thread;
+    if (!isAudioClocked)
+        cpu_thread = std::thread(handleCPU, this);
+
     int status = SimpleRender::run();
+
+    // Wait till CPU Thread Quits
+    isRunning = false;
+    audio.close();
+    if (cpu_thread.joinable()) cpu_thread.join();
+
+    // Input Latency Stats
+    if (isLatencyProbed) {
+        latency.summary(latencyText, sizeof(latencyText));
+        spdlog::info("Display::run: {} Presses Measured {}", latency.getCount(), latencyText);
+        if (!latencyFile.empty()) {
+            std::ofstream statsFile(latencyFile, std::ios::out);
+            latency.report(statsFile);
+        }
+    }
+
+    // Frame Phase Timings
+    if (trace) {
+        if (!trace->writeChrome(traceFile.c_str()))
+            spdlog::error("Display::run: Couldn't Write Trace to '{}'", traceFile);
+        std::stringstream stats;
+        trace->report(stats);
+        spdlog::info("Display::run: Frame Phases (Trace in '{}')\n{}", traceFile, stats.str());
+    }
+
     if (status != 0)
         std::cerr << "Status = " << status << std::endl;
 }
@@ -580,6 +781,113 @@ void Display::setDrawRate(int rate) {
         drawRate = DRAW_RATE;   // Default Draw Rate
 }
 
+/**
+ * Paces Emulation by the Audio Device's Sample Clock
+ *  instead of the System Clock, Falls back to the System
+ *  Clock if no Audio Device Opens
+ * 
+ * @param isPaced - Audio Device is the Master Clock
+ */
+void Display::setAudioPacing(bool isPaced) {
+    isAudioPaced = isPaced;
+}
+
+/**
+ * Sets how many Frames Run-Ahead Emulates past the Real State
+ *  Clamped to RUN_AHEAD_MAX, Clones are made against the
+ *  Loaded ROM's Boot State so the ROM must be Loaded first.
+ *  The Arena is Reserved here, before Audio can Start
+ * 
+ * @param frames - Frames Ahead, 0 Turns Run-Ahead Off
+ */
+void Display::setRunAhead(int frames) {
+    runAheadFrames = std::max(0, std::min(frames, RUN_AHEAD_MAX));
+    if (runAheadFrames) {
+        runAheadArena.reset(new CloneArena(*cpu));
+        runAheadArena->reserveClones(1);
+    }
+}
+
+/**
+ * Latches Keys Late, the CPU Reads the Keys Held as
+ *  EX9E, EXA1, or FX0A Runs rather than as the Frame
+ *  Started, so a Press that Lands
+ *  mid-Frame is Seen by that Frame's Key Reads
+ * 
+ * @param isLate - CPU Asks for the Keys (False Copies them as each Frame Starts)
+ */
+void Display::setLateInput(bool isLate) {
+    isLateInput = isLate;
+    cpu->setKeyProvider(isLateInput ? readKeys : nullptr, this);
+}
+
+/**
+ * Measures Input to Present Latency, each Press is Stamped at
+ *  it's Key Event, the Key Read that first Sees it, the Frame
+ *  Drawn after, and the Present that Shows that Frame. The Read
+ *  is Stamped by observeKeys, Keys are Set as they were before.
+ *  p50/p95/p99 go in the Title Bar, and to the File on Exit
+ * 
+ * @param file - Stats File, Empty for the Title Bar only
+ */
+void Display::setLatencyStats(const std::string &file) {
+    isLatencyProbed = true;
+    latencyFile = file;
+    cpu->setKeyObserver(observeKeys, this);
+}
+
+/**
+ * Key Provider for Late Input, Runs on the CPU Thread
+ * 
+ * @param parent - Display Instance
+ * @returns Keys Held, Bit N = Key 0xN
+ */
+u_int16_t Display::readKeys(void *parent) {
+    Display *display = static_cast<Display *>(parent);
+    return display->keyMask.load(std::memory_order_relaxed);
+}
+
+/**
+ * Key Observer for Input Latency, Runs on the CPU Thread
+ * 
+ * @param mask - Keys the Instruction Read, Bit N = Key 0xN
+ * @param parent - Display Instance
+ */
+void Display::observeKeys(u_int16_t mask, void *parent) {
+    static_cast<Display *>(parent)->latency.onRead(mask);
+}
+
+/**
+ * Times each Frame Phase (Event Polling, CPU, Run-Ahead, Pacing,
+ *  Conversion, Debug Overlay, and Present) into a Lock-Free Ring.
+ *  On Exit the Ring is Written as Chrome Trace Event JSON, and
+ *  p50/p99 per Phase and a Frame Time Histogram are Logged
+ * 
+ * @param file - Trace JSON File (Open in chrome://tracing or Perfetto)
+ */
+void Display::setTrace(const std::string &file) {
+    trace.reset(new FrameTrace());
+    traceFile = file;
+}
+
+/**
+ * Records a Span Ending Now if Tracing
+ * 
+ * @param phase - Part of the Frame Timed
+ * @param thread - Thread Recording
+ * @param start - When the Phase Began
+ */
+void Display::traceSpan(TracePhase phase, TraceThread thread, FrameTrace::Time start) {
+    if (trace) trace->record(phase, thread, start, FrameTrace::now());
+}
+
+/**
+ * Times Event Polling and Dispatch (Event Thread)
+ */
+void Display::onEventPolled(std::chrono::steady_clock::time_point start) {
+    traceSpan(TRACE_EVENTS, TRACE_THREAD_EVENTS, start);
+}
+
 /**
  * Enables Debug Mode
  */
@@ -0,0 +1,116 @@
+#include "../include/FrameTrace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#define TRACE_HISTOGRAM_BUCKETS 34  // 1ms Frame Time Buckets, the Last holds 33ms and up
+
+static const char *phaseNames[TRACE_PHASES] = {
+    "events", "cpu", "run-ahead", "wait", "convert", "overlay", "present", "frame"
+};
+
+static const char *threadNames[] = { "", "render", "cpu", "events" };
+
+
+FrameTrace::FrameTrace() : spans(new TraceSpan[TRACE_CAPACITY]), recorded(0), origin(now()) {}
+
+FrameTrace::Time FrameTrace::now() {
+    return std::chrono::steady_clock::now();
+}
+
+/**
+ * Records a Span, Safe from any Thread while others Record
+ *
+ * @param phase - Part of the Frame Timed
+ * @param thread - Thread it Ran on
+ * @param start - When it Began (FrameTrace::now)
+ * @param end - When it Ended
+ */
+void FrameTrace::record(TracePhase phase, TraceThread thread, Time start, Time end) {
+    uint64_t slot = recorded.fetch_add(1, std::memory_order_relaxed);
+    TraceSpan &span = spans[slot & (TRACE_CAPACITY - 1)];
+    span.start = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin).count());
+    span.duration = u_int32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    span.phase = phase;
+    span.thread = thread;
+}
+
+/**
+ * Writes the Spans still in the Ring as Chrome Trace Event JSON
+ *  (Complete Events, Microseconds). Only once Recording Stopped
+ *
+ * @param path - JSON File to Write
+ * @returns False if the File couldn't be Opened
+ */
+bool FrameTrace::writeChrome(const char *path) const {
+    FILE *file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (u_char tid = TRACE_THREAD_RENDER; tid <= TRACE_THREAD_EVENTS; tid++)
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n",
+                tid, threadNames[tid]);
+
+    uint64_t total = recorded.load(std::memory_order_acquire);
+    uint64_t first = total > TRACE_CAPACITY ? total - TRACE_CAPACITY : 0;
+    for (uint64_t i = first; i < total; i++) {
+        const TraceSpan &span = spans[i & (TRACE_CAPACITY - 1)];
+        fprintf(file, "{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+                phaseNames[span.phase], span.thread, span.start / 1000.0, span.duration / 1000.0,
+                i + 1 < total ? "," : "");
+    }
+
+    fprintf(file, "]}\n");
+    fclose(file);
+    return true;
+}
+
+/**
+ * Writes p50/p99/Max of each Phase, then a Histogram of
+ *  Frame Times (Draw to Draw) in 1ms Buckets
+ *
+ * @param out - Report Stream
+ */
+void FrameTrace::report(std::ostream &out) const {
+    uint64_t total = recorded.load(std::memory_order_acquire);
+    uint64_t first = total > TRACE_CAPACITY ? total - TRACE_CAPACITY : 0;
+
+    std::vector<u_int32_t> durations[TRACE_PHASES];
+    for (uint64_t i = first; i < total; i++) {
+        const TraceSpan &span = spans[i & (TRACE_CAPACITY - 1)];
+        durations[span.phase].push_back(span.duration);
+    }
+
+    char line[128];
+    out << "phase          count      p50 ms   p99 ms   max ms\n";
+    for (int phase = 0; phase < TRACE_PHASES; phase++) {
+        std::vector<u_int32_t> &values = durations[phase];
+        if (values.empty()) continue;
+
+        std::sort(values.begin(), values.end());
+        size_t p50 = values.size() / 2, p99 = std::min(values.size() - 1, values.size() * 99 / 100);
+        snprintf(line, sizeof(line), "%-10s %9zu  %8.3f %8.3f %8.3f\n", phaseNames[phase], values.size(),
+                 values[p50] / 1e6, values[p99] / 1e6, values.back() / 1e6);
+        out << line;
+    }
+
+    // Frame Time Histogram
+    const std::vector<u_int32_t> &frames = durations[TRACE_FRAME];
+    if (frames.empty()) return;
+
+    size_t buckets[TRACE_HISTOGRAM_BUCKETS] = {};
+    for (u_int32_t duration : frames)
+        buckets[std::min<size_t>(duration / 1000000, TRACE_HISTOGRAM_BUCKETS - 1)]++;
+
+    size_t peak = *std::max_element(buckets, buckets + TRACE_HISTOGRAM_BUCKETS);
+    out << "frame time histogram (1ms buckets)\n";
+    for (int bucket = 0; bucket < TRACE_HISTOGRAM_BUCKETS; bucket++) {
+        if (!buckets[bucket]) continue;
+        snprintf(line, sizeof(line), "%3d%s ms %9zu ", bucket, bucket == TRACE_HISTOGRAM_BUCKETS - 1 ? "+" : " ",
+                 buckets[bucket]);
+        out << line << std::string(buckets[bucket] * 50 / peak, '#') << '\n';
+    }
+}
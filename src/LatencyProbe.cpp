@@ -0,0 +1,166 @@
+#include "../include/LatencyProbe.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ostream>
+
+
+LatencyProbe::LatencyProbe()
+    : progress(LATENCY_IDLE), keyBit(0x0), pressTime(0), readTime(0), drawTime(0), samples(), count(0) {}
+
+uint64_t LatencyProbe::now() {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * Starts Following a Press unless one is already in Flight,
+ *  a Press that's gone Unread for LATENCY_TIMEOUT is Dropped
+ *  (the ROM may not be Polling that Key)
+ *
+ * @param key - Key 0x0-0xF that went Down
+ */
+void LatencyProbe::onPress(u_char key) {
+    uint64_t time = now();
+    uint64_t current = progress.load(std::memory_order_acquire);
+    if ((current & 0xFF) != LATENCY_IDLE && time - pressTime.load(std::memory_order_relaxed) < LATENCY_TIMEOUT)
+        return;
+
+    pressTime.store(time, std::memory_order_relaxed);
+    keyBit.store(u_int16_t(0x1 << (key & 0xF)), std::memory_order_relaxed);
+    progress.store((((current >> 8) + 1) << 8) | LATENCY_PRESSED, std::memory_order_release);
+}
+
+/**
+ * Stamps the First Read that Sees the Followed Key Down
+ *
+ * @param mask - Keys the ROM Latched, Bit N = Key 0xN
+ */
+void LatencyProbe::onRead(u_int16_t mask) {
+    uint64_t current = progress.load(std::memory_order_acquire);
+    if ((current & 0xFF) != LATENCY_PRESSED || !(mask & keyBit.load(std::memory_order_relaxed)))
+        return;
+
+    readTime.store(now(), std::memory_order_relaxed);
+    progress.compare_exchange_strong(current, (current & ~uint64_t(0xFF)) | LATENCY_READ, std::memory_order_acq_rel);
+}
+
+/**
+ * Stamps the First Frame Drawn after the Read, that Frame and
+ *  any Published before it's Presented carry the Sequence
+ *
+ * @returns Sequence to Tag the Frame with, 0 if no Press is Drawn
+ */
+u_int32_t LatencyProbe::onPublish() {
+    uint64_t current = progress.load(std::memory_order_acquire);
+    u_char stage = current & 0xFF;
+    if (stage == LATENCY_READ) {
+        drawTime.store(now(), std::memory_order_relaxed);
+        if (!progress.compare_exchange_strong(current, (current & ~uint64_t(0xFF)) | LATENCY_DRAWN, std::memory_order_acq_rel))
+            return 0;
+    } else if (stage != LATENCY_DRAWN) {
+        return 0;
+    }
+    return u_int32_t(current >> 8);
+}
+
+/**
+ * Completes the Press the Presented Frame was Tagged with,
+ *  Recording it's Phases and Waiting for the Next Press
+ *
+ * @param tag - Frame's Sequence (From onPublish)
+ */
+void LatencyProbe::onPresent(u_int32_t tag) {
+    uint64_t current = progress.load(std::memory_order_acquire);
+    if (!tag || (current & 0xFF) != LATENCY_DRAWN || u_int32_t(current >> 8) != tag)
+        return;
+
+    uint64_t time = now();
+    uint64_t press = pressTime.load(std::memory_order_relaxed);
+    uint64_t read = readTime.load(std::memory_order_relaxed);
+    uint64_t draw = drawTime.load(std::memory_order_relaxed);
+
+    LatencySample &sample = samples[count % LATENCY_SAMPLES];
+    sample.read = u_int32_t((read - press) / 1000);
+    sample.draw = u_int32_t((draw - read) / 1000);
+    sample.present = u_int32_t((time - draw) / 1000);
+    sample.total = u_int32_t((time - press) / 1000);
+    count++;
+
+    progress.compare_exchange_strong(current, (current & ~uint64_t(0xFF)) | LATENCY_IDLE, std::memory_order_acq_rel);
+}
+
+u_int32_t LatencyProbe::getCount() const {
+    return count;
+}
+
+/**
+ * Nearest Rank Percentile of one Phase over the Samples
+ *
+ * @param phase - LatencySample Field
+ * @param from - Samples
+ * @param size - Number of Samples (Non-Zero)
+ * @param rank - Percentile, 0.0-1.0
+ * @returns Phase's Percentile in Microseconds
+ */
+u_int32_t LatencyProbe::percentile(u_int32_t LatencySample::*phase, const LatencySample *from, u_int32_t size, double rank) {
+    u_int32_t values[LATENCY_SAMPLES];
+    for (u_int32_t i = 0; i < size; i++)
+        values[i] = from[i].*phase;
+
+    u_int32_t index = std::min(size - 1, u_int32_t(rank * size));
+    std::nth_element(values, values + index, values + size);
+    return values[index];
+}
+
+/**
+ * Writes the Total Latency Percentiles in Milliseconds
+ *
+ * @param buffer - Output, Empty if no Press has Completed
+ * @param size - Size of the Buffer
+ */
+void LatencyProbe::summary(char *buffer, size_t size) const {
+    u_int32_t used = std::min(count, u_int32_t(LATENCY_SAMPLES));
+    if (!used) {
+        if (size) buffer[0] = '\0';
+        return;
+    }
+
+    snprintf(buffer, size, "Input p50 %.1f / p95 %.1f / p99 %.1f ms",
+             percentile(&LatencySample::total, samples, used, 0.50) / 1000.0,
+             percentile(&LatencySample::total, samples, used, 0.95) / 1000.0,
+             percentile(&LatencySample::total, samples, used, 0.99) / 1000.0);
+}
+
+/**
+ * Writes every Phase's Percentiles over the Last
+ *  LATENCY_SAMPLES Presses, in Milliseconds
+ *
+ * @param out - Stats Stream
+ */
+void LatencyProbe::report(std::ostream &out) const {
+    static const struct {
+        const char *name;
+        u_int32_t LatencySample::*phase;
+    } phases[] = {
+        { "event->read", &LatencySample::read },
+        { "read->draw", &LatencySample::draw },
+        { "draw->present", &LatencySample::present },
+        { "event->present", &LatencySample::total },
+    };
+
+    u_int32_t used = std::min(count, u_int32_t(LATENCY_SAMPLES));
+    out << "presses " << count << " (percentiles over the last " << used << ", ms)\n";
+    if (!used) return;
+
+    char line[128];
+    out << "phase            p50      p95      p99\n";
+    for (const auto &phase : phases) {
+        snprintf(line, sizeof(line), "%-14s %7.2f  %7.2f  %7.2f\n", phase.name,
+                 percentile(phase.phase, samples, used, 0.50) / 1000.0,
+                 percentile(phase.phase, samples, used, 0.95) / 1000.0,
+                 percentile(phase.phase, samples, used, 0.99) / 1000.0);
+        out << line;
+    }
+}
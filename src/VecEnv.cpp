@@ -0,0 +1,313 @@
+#include "../include/VecEnv.h"
+#include "../include/Disassembler.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+// Neighbouring Instances, each Owned by one Thread, mustn't Share a Cache Line
+static_assert(alignof(CHIP8State) % 64 == 0 && sizeof(CHIP8State) % 64 == 0, "States must fill whole Cache Lines");
+
+
+/**
+ * Constructs count Blank Instances and Starts the Worker Pool
+ *  Load a ROM before the first reset
+ *
+ * @param count - Number of Instances
+ * @param threads - Threads Stepping Instances, 0 for every Hardware Thread
+ */
+VecEnv::VecEnv(u_int32_t count, u_int32_t threads)
+    : states(count, prototype.getBootState()), slots(count, EnvSlot{}), hookLines(0),
+      frameSkip(ENV_FRAME_SKIP), ipf(ENV_IPF), maxFrames(0), jobSeeds(nullptr), jobActions(nullptr),
+      jobObs(nullptr), jobRewards(nullptr), jobDones(nullptr), generation(0), pending(0), isStopping(false) {
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    threads = max(1u, min(threads, count));
+    runners.assign(threads, prototype);
+
+    // Workers already Started are Stopped if one Fails to Start
+    try {
+        for (u_int32_t slice = 1; slice < threads; slice++)
+            workers.emplace_back(&VecEnv::workerLoop, this, slice);
+    } catch (...) {
+        stopWorkers();
+        throw;
+    }
+}
+
+VecEnv::~VecEnv() {
+    stopWorkers();
+}
+
+/**
+ * Stops and Joins the Worker Pool
+ */
+void VecEnv::stopWorkers() {
+    {
+        lock_guard<mutex> guard(lock);
+        isStopping = true;
+    }
+    wake.notify_all();
+    for (thread &worker : workers)
+        worker.join();
+}
+
+/**
+ * Loads the ROM into one Core, Decodes it ahead of Time,
+ *  then Copies that Core into every Runner and it's
+ *  Boot Image into every Instance
+ *
+ * @param rom - ROM's Bytes
+ * @param size - Size of the ROM in Bytes
+ * @returns False if the ROM doesn't fit in Memory
+ */
+bool VecEnv::loadROM(const u_char *rom, size_t size) {
+    if (!prototype.loadROM(rom, size))
+        return false;
+
+    Disassembler dasm;
+    prototype.prewarm(dasm.analyze(rom, u_int16_t(min<size_t>(size, MEMORY_SIZE - ROM_START))));
+
+    for (CHIP8 &runner : runners)
+        runner = prototype;
+    for (size_t i = 0; i < states.size(); i++) {
+        states[i] = prototype.getBootState();
+        slots[i].dirtyPages = 0x0;
+    }
+    return true;
+}
+
+void VecEnv::setFrameSkip(u_int32_t frames) {
+    frameSkip = max(1u, frames);
+}
+
+void VecEnv::setIPF(u_int32_t instructions) {
+    ipf = instructions;
+}
+
+void VecEnv::setMaxFrames(u_int32_t frames) {
+    maxFrames = frames;
+}
+
+/**
+ * Rewards Changes in a Memory Byte, such as a Score
+ *  Counts from the Instances' Current Memory
+ *
+ * @param addr - Memory Address of the Byte
+ * @param scale - Reward per Unit the Byte Grew (Negative to Penalize)
+ */
+void VecEnv::addRewardHook(u_int16_t addr, float scale) {
+    // Allocations come First, so a Failed one Leaves the Hooks as they were
+    rewardHooks.reserve(rewardHooks.size() + 1);
+
+    // Widen every Instance's Lines once the Hooks Outgrow them
+    size_t lines = (rewardHooks.size() + sizeof(HookLine)) / sizeof(HookLine);
+    if (lines != hookLines) {
+        vector<HookLine> wider(states.size() * lines, HookLine{});
+        for (size_t i = 0; i < states.size(); i++)
+            for (size_t line = 0; line < hookLines; line++)
+                wider[i * lines + line] = hookValues[i * hookLines + line];
+        hookValues.swap(wider);
+        hookLines = lines;
+    }
+
+    rewardHooks.push_back({addr, scale});
+
+    for (size_t i = 0; i < states.size(); i++)
+        hookValue(i, rewardHooks.size() - 1) = memVal(i, addr);
+}
+
+/**
+ * Ends Episodes once a Memory Byte Equals the Value, such as Lives
+ *  reaching 0. Faults (Stack Errors, 00FD) always End Episodes
+ *
+ * @param addr - Memory Address of the Byte
+ * @param value - Value that Ends the Episode
+ */
+void VecEnv::addDoneHook(u_int16_t addr, u_char value) {
+    doneHooks.push_back({addr, value});
+}
+
+/**
+ * Starts a new Episode on every Instance
+ *
+ * @param seeds - Seed per Instance, NULL Seeds Instance i with i
+ * @param obs - Filled with ENV_OBS_WORDS Packed Words per Instance (NULL to Skip)
+ */
+void VecEnv::reset(const uint64_t *seeds, uint64_t *obs) {
+    jobSeeds = seeds;
+    jobActions = nullptr;
+    jobObs = obs;
+    runJob();
+}
+
+/**
+ * Steps every Instance by frameSkip Frames, Holding its Action's
+ *  Keys throughout. Instances Done on the Last Step are first
+ *  Reset, Seeded with their Last Seed plus the Instance Count
+ *
+ * @param actions - Key Mask per Instance, Bit N = Key 0xN Pressed
+ * @param obs - Filled with ENV_OBS_WORDS Packed Words per Instance (NULL to Skip)
+ * @param rewards - Filled with each Instance's Reward (NULL to Skip)
+ * @param dones - Set to 1 where the Episode Ended (NULL to Skip)
+ */
+void VecEnv::step(const u_int16_t *actions, uint64_t *obs, float *rewards, u_char *dones) {
+    jobActions = actions;
+    jobObs = obs;
+    jobRewards = rewards;
+    jobDones = dones;
+    runJob();
+}
+
+size_t VecEnv::size() const {
+    return states.size();
+}
+
+const CHIP8State &VecEnv::getState(size_t i) const {
+    return states[i];
+}
+
+/**
+ * Worker Thread, Runs its Slice of every Job until Stopped
+ *
+ * @param slice - Slice of Instances this Worker Owns
+ */
+void VecEnv::workerLoop(u_int32_t slice) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [&] { return isStopping || generation != seen; });
+            if (isStopping) return;
+            seen = generation;
+        }
+
+        runSlice(slice);
+
+        lock_guard<mutex> guard(lock);
+        if (--pending == 0)
+            finished.notify_one();
+    }
+}
+
+/**
+ * Hands the Job to the Workers, Runs Slice 0 meanwhile,
+ *  then Waits for the rest
+ */
+void VecEnv::runJob() {
+    if (workers.empty()) {
+        runSlice(0);
+        return;
+    }
+
+    {
+        lock_guard<mutex> guard(lock);
+        pending = u_int32_t(workers.size());
+        generation++;
+    }
+    wake.notify_all();
+
+    runSlice(0);
+
+    unique_lock<mutex> guard(lock);
+    finished.wait(guard, [&] { return pending == 0; });
+}
+
+/**
+ * Runs the Job on one Contiguous Slice of Instances
+ *
+ * @param slice - Slice Index, 0 to the Thread Count
+ */
+void VecEnv::runSlice(u_int32_t slice) {
+    size_t slices = workers.size() + 1;
+    size_t begin = states.size() * slice / slices;
+    size_t end = states.size() * (slice + 1) / slices;
+
+    CHIP8 &runner = runners[slice];
+    for (size_t i = begin; i < end; i++) {
+        if (jobActions) stepInstance(runner, i);
+        else resetInstance(runner, i, jobSeeds ? jobSeeds[i] : i);
+
+        if (jobObs) observe(i, jobObs + i * ENV_OBS_WORDS);
+    }
+}
+
+/**
+ * Restarts an Instance from the ROM's Boot Image
+ *
+ * @param runner - Slice's Runner Core, Seeds the Boot Image
+ * @param i - Instance Index
+ * @param seed - Seed for the Episode's Random Numbers
+ */
+void VecEnv::resetInstance(CHIP8 &runner, size_t i, uint64_t seed) {
+    runner.seed(seed);
+    states[i] = runner.getBootState();
+
+    EnvSlot &slot = slots[i];
+    slot.seed = seed;
+    slot.dirtyPages = 0x0;
+    slot.frameCount = 0;
+    slot.isDone = 0x0;
+    for (size_t hook = 0; hook < rewardHooks.size(); hook++)
+        hookValue(i, hook) = memVal(i, rewardHooks[hook].addr);
+}
+
+/**
+ * Runs one Step of the Current Job on an Instance,
+ *  Swapping it's State through the Slice's Runner
+ *
+ * @param runner - Slice's Runner Core
+ * @param i - Instance Index
+ */
+void VecEnv::stepInstance(CHIP8 &runner, size_t i) {
+    EnvSlot &slot = slots[i];
+    if (slot.isDone)
+        resetInstance(runner, i, slot.seed + states.size());
+
+    runner.loadState(states[i], slot.dirtyPages);
+
+    u_int16_t keys = jobActions[i];
+    for (u_char k = 0x0; k <= 0xF; k++)
+        runner.key[k] = (keys >> k) & 0x1;
+
+    for (u_int32_t frame = 0; frame < frameSkip && !runner.getFault(); frame++) {
+        runner.runFrame(ipf);
+        slot.frameCount++;
+    }
+    slot.dirtyPages = runner.saveState(states[i]);
+
+    float reward = 0.0f;
+    for (size_t hook = 0; hook < rewardHooks.size(); hook++) {
+        u_char &last = hookValue(i, hook);
+        u_char value = memVal(i, rewardHooks[hook].addr);
+        reward += rewardHooks[hook].scale * float(int(value) - int(last));
+        last = value;
+    }
+
+    bool done = states[i].fault || (maxFrames && slot.frameCount >= maxFrames);
+    for (const DoneHook &hook : doneHooks)
+        done = done || memVal(i, hook.addr) == hook.value;
+    slot.isDone = done;
+
+    if (jobRewards) jobRewards[i] = reward;
+    if (jobDones) jobDones[i] = done;
+}
+
+u_char &VecEnv::hookValue(size_t i, size_t hook) {
+    return hookValues[i * hookLines + hook / sizeof(HookLine)].values[hook % sizeof(HookLine)];
+}
+
+u_char VecEnv::memVal(size_t i, u_int16_t addr) const {
+    return addr < MEMORY_SIZE ? states[i].memory[addr] : 0x00;  // Out of Bounds Reads 0, as CHIP8::getMemVal
+}
+
+/**
+ * Packs an Instance's Display (Plane 1, 128x64) as yac8_get_framebuffer_hires
+ *  obs[y * 2] Bit 63 is x = 0, 64x32 only Uses Word 0 of Rows 0-31
+ *
+ * @param i - Instance Index
+ * @param obs - ENV_OBS_WORDS Words to Fill
+ */
+void VecEnv::observe(size_t i, uint64_t *obs) const {
+    memcpy(obs, states[i].display[0], ENV_OBS_WORDS * sizeof(uint64_t));
+}
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <string>
 
+#include "../include/AnalysisCache.h"
 #include "../include/CHIP-8.h"
 #include "../include/Disassembler.h"
 #include "../include/Display.h"
@@ -18,6 +21,18 @@ int main(int argc, char **argv) {
     bool isDebug = false;
     int USER_DEFINED_DRAW_SPEED = -1;
     int USER_DEFINED_DRAW_SCALE = DEFAULT_DRAW_SCALE;
+    bool isSeeded = false;
+    int headlessFrames = 0;
+    string cacheDir = AnalysisCache::defaultDir();
+    bool isCached = true;
+    bool isAudioPaced = false;
+    bool isXOChip = false;
+    int runAheadFrames = 0;
+    bool isLateInput = false;
+    bool isLatencyProbed = false;
+    string latencyFile;
+    string traceFile;
+    unsigned long long USER_DEFINED_SEED = 0;
 
     // Check Arguments
     for (int i = 0; i < argc; ++i) {
@@ -35,7 +50,17 @@ int main(int argc, char **argv) {
                  << "-d \t\t\t Disassemble Given Rom\n"
                  << "--debug \t\t Enables Debug Mode\n"
                  << "--scale [scaleVal] \t Sets Scale Value\n"
-                 << "--speed [speedVal] \t Sets Speed Value\n";
+                 << "--speed [speedVal] \t Sets Speed Value\n"
+                 << "--seed [seedVal] \t Sets Random Seed (Same Seed, Same Run)\n"
+                 << "--headless [frames] \t Runs without a Window, Printing each Frame's State Hash\n"
+                 << "--cache-dir [dir] \t Sets ROM Analysis Cache Directory\n"
+                 << "--no-cache \t\t Analyzes the ROM without the Cache\n"
+                 << "--audio-sync \t\t Paces Emulation by the Audio Device's Clock\n"
+                 << "--xo-chip \t\t Runs in XO-CHIP Mode (64KB Memory), Default for .xo8 ROMs\n"
+                 << "--run-ahead [frames] \t Presents 1-4 Frames Ahead to Hide the ROM's Input Lag\n"
+                 << "--late-input \t\t Latches Keys when the ROM Reads them (SKP/SKNP/FX0A)\n"
+                 << "--latency [file] \t Shows Input to Present Latency p50/p95/p99, Stats File Written on Exit\n"
+                 << "--trace [file] \t\t Times each Frame Phase, Chrome Trace JSON Written on Exit\n";
             exit(0);
         } 
         else if (arg == "-d") {                         // Disassemble and Output
@@ -56,6 +81,46 @@ int main(int argc, char **argv) {
             USER_DEFINED_DRAW_SPEED = stoi(argv[i+1]);
             i++;
         }
+        else if (arg == "--seed" && (i+1) < argc) {     // User Defined Random Seed
+            USER_DEFINED_SEED = stoull(argv[i+1]);
+            isSeeded = true;
+            i++;
+        }
+        else if (arg == "--headless" && (i+1) < argc) { // Run without Display
+            headlessFrames = stoi(argv[i+1]);
+            i++;
+        }
+        else if (arg == "--cache-dir" && (i+1) < argc) { // ROM Analysis Cache Location
+            cacheDir = argv[i+1];
+            i++;
+        }
+        else if (arg == "--no-cache") {                 // Always Analyze
+            isCached = false;
+        }
+        else if (arg == "--audio-sync") {               // Audio Device is the Master Clock
+            isAudioPaced = true;
+        }
+        else if (arg == "--xo-chip") {                  // XO-CHIP Mode
+            isXOChip = true;
+        }
+        else if (arg == "--run-ahead" && (i+1) < argc) { // Frames to Run Ahead
+            runAheadFrames = stoi(argv[i+1]);
+            i++;
+        }
+        else if (arg == "--late-input") {               // Keys Latched on Read
+            isLateInput = true;
+        }
+        else if (arg == "--trace" && (i+1) < argc) {    // Frame Phase Trace File
+            traceFile = argv[i+1];
+            i++;
+        }
+        else if (arg == "--latency") {                  // Input Latency Stats, Optional Stats File
+            isLatencyProbed = true;
+            if ((i+1) < argc && argv[i+1][0] != '-') {
+                latencyFile = argv[i+1];
+                i++;
+            }
+        }
         else if (arg == "--scale" && (i+1) < argc) {    // User Defined Draw Scale
             USER_DEFINED_DRAW_SCALE = stoi(argv[i+1]);
             i++;
@@ -93,11 +158,50 @@ int main(int argc, char **argv) {
         exit(0);
     }
 
-    // CHIP-8 Run
+    // Read ROM Once for both Loading and Analysis
+    vector<u_char> rom;
+    if (!dasm.readROM(romPath, rom)) {
+        cerr << "Failed to Read ROM '" << romPath << "'\n";
+        exit(1);
+    }
+
+    // XO-CHIP ROMs use the '.xo8' Extension
+    string path = romPath;
+    if (path.size() > 4 && path.compare(path.size() - 4, 4, ".xo8") == 0)
+        isXOChip = true;
+
+    // CHIP-8 Run | Mode Sizes Memory, so it's Set before Loading
     CHIP8 cpu;
+    if (isXOChip)
+        cpu.setMode(MODE_XO_CHIP);
+    u_int16_t romSize = u_int16_t(min<size_t>(rom.size(), cpu.getMemSize() - ROM_START));
+    cpu.loadROM(rom.data(), romSize);
+    if (isSeeded)
+        cpu.seed(USER_DEFINED_SEED);
+
+    // Decode ROM's Code ahead of Time | Analysis Cached by ROM Content
+    //  Only the Low 4KB is Decode Cached, so only it's Analyzed
+    u_int16_t analyzedSize = u_int16_t(min<size_t>(romSize, MEMORY_SIZE - ROM_START));
+    AnalysisCache cache(cacheDir);
+    cpu.prewarm(isCached ? cache.analyze(rom.data(), analyzedSize) : dasm.analyze(rom.data(), analyzedSize));
+
+    // Headless Run | One "frame hash" Line per Frame, No Keys Pressed
+    if (headlessFrames > 0) {
+        int ipf = USER_DEFINED_DRAW_SPEED > 0 ? USER_DEFINED_DRAW_SPEED : DRAW_RATE;
+        for (int frame = 0; frame < headlessFrames; frame++) {
+            cpu.runFrame(ipf);
+            cout << frame << ' ' << hex << setw(16) << setfill('0') << cpu.hashState() << dec << '\n';
+        }
+        exit(0);
+    }
+
     Display display(&cpu, USER_DEFINED_DRAW_SCALE); // Setup Display with Scale
     display.setDrawRate(USER_DEFINED_DRAW_SPEED);   // Set Draw Rate | Default if none given
-    cpu.loadROM(romPath);
+    display.setAudioPacing(isAudioPaced);           // Audio or System Clock Paces Emulation
+    display.setRunAhead(runAheadFrames);            // Present Frames Ahead of the Real State
+    display.setLateInput(isLateInput);              // Keys Latched by the CPU or Set by Events
+    if (isLatencyProbed) display.setLatencyStats(latencyFile);  // Input to Present Latency
+    if (!traceFile.empty()) display.setTrace(traceFile);        // Frame Phase Timings
 
     // Check to turn on Debug Mode
     if (isDebug) {
@@ -0,0 +1,311 @@
+#include "../include/yac8.h"
+#include "../include/CHIP-8.h"
+#include "../include/CloneArena.h"
+#include "../include/VecEnv.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * C Interface Handles wrap the C++ Core
+ *  Exceptions never Cross the C Interface, Entry Points
+ *  that Allocate Catch them and Return NULL or -1
+ */
+struct yac8_t {
+    CHIP8 cpu;
+};
+
+struct yac8_snapshot_t {
+    Mode mode;                      // Mode the Core was in
+    CHIP8State state;               // Machine State
+    std::vector<u_char> xoMemory;   // XO-CHIP's 64KB Memory (Empty in CHIP-8 Mode)
+};
+
+struct yac8_arena_t {
+    CloneArena arena;
+};
+
+struct yac8_env_t {
+    VecEnv env;
+
+    yac8_env_t(u_int32_t count, u_int32_t threads) : env(count, threads) {}
+};
+
+
+/**
+ * Creates a new Core
+ */
+yac8_t *yac8_create(void) {
+    try {
+        return new yac8_t();
+    } catch (...) {
+        return NULL;
+    }
+}
+
+/**
+ * Destroys the Core
+ */
+void yac8_destroy(yac8_t *core) {
+    delete core;
+}
+
+/**
+ * Picks CHIP-8 or XO-CHIP, Clearing the Core
+ */
+int yac8_set_mode(yac8_t *core, int mode) {
+    if (mode != YAC8_MODE_CHIP8 && mode != YAC8_MODE_XO_CHIP)
+        return -1;
+
+    try {
+        core->cpu.setMode(mode == YAC8_MODE_XO_CHIP ? MODE_XO_CHIP : MODE_CHIP8);
+    } catch (...) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Loads ROM Buffer into Memory
+ */
+int yac8_load_rom(yac8_t *core, const uint8_t *rom, size_t size) {
+    try {
+        return core->cpu.loadROM(rom, size) ? 0 : -1;
+    } catch (...) {
+        return -1;
+    }
+}
+
+/**
+ * Restores the Core to it's Boot Image
+ */
+void yac8_reset(yac8_t *core) {
+    core->cpu.reset();
+}
+
+/**
+ * Seeds the Core's Random Generator
+ */
+void yac8_seed(yac8_t *core, uint64_t seed) {
+    core->cpu.seed(seed);
+}
+
+/**
+ * Runs given number of Instructions
+ */
+void yac8_step(yac8_t *core, uint32_t count) {
+    core->cpu.step(count);
+}
+
+/**
+ * Runs a Single Frame
+ */
+int yac8_run_frame(yac8_t *core, uint32_t instructions) {
+    return core->cpu.runFrame(instructions) ? 1 : 0;
+}
+
+/**
+ * Sets all 16 Keys from a Mask
+ */
+void yac8_set_keys(yac8_t *core, uint16_t keyMask) {
+    for (u_char i = 0x0; i <= 0xF; i++)
+        core->cpu.key[i] = (keyMask >> i) & 0x1;
+}
+
+/**
+ * Sets the Key Provider, Called on every Key Read
+ */
+void yac8_set_key_provider(yac8_t *core, yac8_key_provider_t provider, void *userdata) {
+    core->cpu.setKeyProvider(provider, userdata);
+}
+
+/**
+ * Returns the Fault that Halted the Core
+ */
+int yac8_get_fault(const yac8_t *core) {
+    return core->cpu.getFault();
+}
+
+/**
+ * Hashes the Core's State
+ */
+uint64_t yac8_state_hash(const yac8_t *core) {
+    return core->cpu.hashState();
+}
+
+/**
+ * Copies out the 64x32 Display, the Left Word of each Row of Plane 1
+ */
+void yac8_get_framebuffer(const yac8_t *core, uint64_t rows[YAC8_DISPLAY_HEIGHT]) {
+    const CHIP8State &state = core->cpu.getState();
+    for (int y = 0; y < YAC8_DISPLAY_HEIGHT; y++)
+        rows[y] = state.display[0][y][0];
+}
+
+/**
+ * Returns whether the Core is in SUPER-CHIP 128x64 Mode
+ */
+int yac8_is_hires(const yac8_t *core) {
+    return core->cpu.isHires();
+}
+
+/**
+ * Copies out Plane 1's whole 128x64 Display, already Packed into Word Pairs
+ */
+void yac8_get_framebuffer_hires(const yac8_t *core, uint64_t rows[YAC8_HIRES_HEIGHT * 2]) {
+    memcpy(rows, core->cpu.getState().display[0], sizeof(uint64_t) * YAC8_HIRES_HEIGHT * 2);
+}
+
+/**
+ * Composites every Plane through the Palette
+ */
+void yac8_get_pixels(const yac8_t *core, const uint32_t palette[4], uint32_t *pixels) {
+    const CHIP8State &state = core->cpu.getState();
+    compositeDisplay(state.display, state.hires, palette, pixels);
+}
+
+/**
+ * Saves a Copy of the Core's Machine State, not it's Decodes or Boot Image
+ */
+yac8_snapshot_t *yac8_snapshot_create(const yac8_t *core) {
+    std::unique_ptr<yac8_snapshot_t> snapshot;
+    try {
+        snapshot.reset(new yac8_snapshot_t());
+        snapshot->mode = core->cpu.getMode();
+        snapshot->state = core->cpu.getState();
+        if (snapshot->mode == MODE_XO_CHIP)
+            snapshot->xoMemory.assign(core->cpu.getMemory(), core->cpu.getMemory() + XO_MEMORY_SIZE);
+    } catch (...) {
+        return NULL;
+    }
+    return snapshot.release();
+}
+
+/**
+ * Restores the Core to the Snapshot's State through setState
+ */
+int yac8_snapshot_restore(yac8_t *core, const yac8_snapshot_t *snapshot) {
+    if (core->cpu.getMode() != snapshot->mode)
+        return -1;
+
+    core->cpu.setState(snapshot->state, snapshot->xoMemory.empty() ? NULL : snapshot->xoMemory.data());
+    return 0;
+}
+
+/**
+ * Frees the Snapshot
+ */
+void yac8_snapshot_destroy(yac8_snapshot_t *snapshot) {
+    delete snapshot;
+}
+
+/**
+ * Creates a Clone Arena holding the Core's Boot Image
+ */
+yac8_arena_t *yac8_arena_create(const yac8_t *core) {
+    try {
+        return new yac8_arena_t{CloneArena(core->cpu)};
+    } catch (...) {
+        return NULL;
+    }
+}
+
+/**
+ * Frees the Arena and every Clone in it
+ */
+void yac8_arena_destroy(yac8_arena_t *arena) {
+    delete arena;
+}
+
+void yac8_arena_clear(yac8_arena_t *arena) {
+    arena->arena.clear();
+}
+
+size_t yac8_arena_bytes(const yac8_arena_t *arena) {
+    return arena->arena.bytesUsed();
+}
+
+/**
+ * Clones the Core into the Arena, NULL if the Arena couldn't Grow
+ */
+const yac8_clone_t *yac8_clone(yac8_arena_t *arena, const yac8_t *core, const yac8_clone_t *parent) {
+    try {
+        const CoreClone *copy = core->cpu.clone(arena->arena, reinterpret_cast<const CoreClone *>(parent));
+        return reinterpret_cast<const yac8_clone_t *>(copy);
+    } catch (...) {
+        return NULL;
+    }
+}
+
+/**
+ * Restores the Core to a Clone's State
+ */
+void yac8_clone_restore(yac8_t *core, const yac8_arena_t *arena, const yac8_clone_t *clone) {
+    core->cpu.restore(arena->arena, reinterpret_cast<const CoreClone *>(clone));
+}
+
+/**
+ * Creates the Environment and Loads the ROM into every Instance
+ */
+yac8_env_t *yac8_env_create(const uint8_t *rom, size_t size, uint32_t count, uint32_t threads) {
+    std::unique_ptr<yac8_env_t> env;
+    try {
+        env.reset(new yac8_env_t(count, threads));
+        if (!env->env.loadROM(rom, size))
+            return NULL;
+    } catch (...) {
+        return NULL;
+    }
+    return env.release();
+}
+
+/**
+ * Stops the Environment's Threads and Frees it
+ */
+void yac8_env_destroy(yac8_env_t *env) {
+    delete env;
+}
+
+void yac8_env_set_frame_skip(yac8_env_t *env, uint32_t frames) {
+    env->env.setFrameSkip(frames);
+}
+
+void yac8_env_set_ipf(yac8_env_t *env, uint32_t instructions) {
+    env->env.setIPF(instructions);
+}
+
+void yac8_env_set_max_frames(yac8_env_t *env, uint32_t frames) {
+    env->env.setMaxFrames(frames);
+}
+
+int yac8_env_add_reward(yac8_env_t *env, uint16_t addr, float scale) {
+    try {
+        env->env.addRewardHook(addr, scale);
+    } catch (...) {
+        return -1;
+    }
+    return 0;
+}
+
+int yac8_env_add_done(yac8_env_t *env, uint16_t addr, uint8_t value) {
+    try {
+        env->env.addDoneHook(addr, value);
+    } catch (...) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Starts a new Episode on every Instance
+ */
+void yac8_env_reset(yac8_env_t *env, const uint64_t *seeds, uint64_t *obs) {
+    env->env.reset(seeds, obs);
+}
+
+/**
+ * Steps every Instance
+ */
+void yac8_env_step(yac8_env_t *env, const uint16_t *actions, uint64_t *obs, float *rewards, uint8_t *dones) {
+    env->env.step(actions, obs, rewards, dones);
+}
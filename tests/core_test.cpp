@@ -0,0 +1,748 @@
+/**
+ * Core Regression Tests, Run by ctest
+ *  Each Test Boots a Small ROM and Checks the Machine after it
+ */
+#include "CHIP-8.h"
+#include "CloneArena.h"
+#include "yac8.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+static int failures = 0;
+
+#define CHECK(condition)                                                                  \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            cerr << __FILE__ << ':' << __LINE__ << ": " << __func__ << ": " << #condition << '\n'; \
+            failures++;                                                                   \
+        }                                                                                 \
+    } while (0)
+
+
+/**
+ * Stack Overflow and Underflow Halt the CPU on the Faulting
+ *  Instruction, in the Decode Cache (step) and Interpreter (run)
+ */
+static void testStackFaults() {
+    const u_char overflow[] = {
+        0x22, 0x00,  // CALL 0x200 (Recurses until the Stack is Full)
+    };
+    const u_char underflow[] = {
+        0x60, 0x01,  // LD V0, 1
+        0x00, 0xEE,  // RET (Empty Stack)
+    };
+
+    for (bool isInterpreted : {false, true}) {
+        CHIP8 cpu;
+        CHECK(cpu.loadROM(overflow, sizeof(overflow)));
+        for (int i = 0; i < 20; i++) {
+            if (isInterpreted) cpu.run(true);
+            else cpu.step(1);
+        }
+        CHECK(cpu.getFault() == FAULT_STACK_OVERFLOW);
+        CHECK(cpu.getProgramCounter() == 0x200);
+        CHECK(cpu.getState().SP == 16);
+
+        // Halted CPU doesn't Run
+        uint64_t hash = cpu.hashState();
+        cpu.step(10);
+        cpu.run(true);
+        CHECK(cpu.hashState() == hash);
+
+        CHIP8 empty;
+        CHECK(empty.loadROM(underflow, sizeof(underflow)));
+        for (int i = 0; i < 4; i++) {
+            if (isInterpreted) empty.run(true);
+            else empty.step(1);
+        }
+        CHECK(empty.getFault() == FAULT_STACK_UNDERFLOW);
+        CHECK(empty.getProgramCounter() == 0x202);
+        CHECK(empty.getRegisterVal(0x0) == 0x01);
+
+        // reset Clears the Fault
+        empty.reset();
+        CHECK(empty.getFault() == FAULT_NONE);
+        CHECK(empty.getProgramCounter() == 0x200);
+    }
+}
+
+
+/**
+ * reset Restores the Boot Image without Re-Loading the ROM: Self-
+ *  Modified Code Runs as Loaded again, while Code on Clean Pages
+ *  (Decodes Kept) Runs the same as on the First Boot
+ */
+static void testResetRestoresBootImage() {
+    u_char rom[0x84] = {
+        0x61, 0x01,  // 0x200: LD V1, 1 (Rewritten to LD V1, 5)
+        0x32, 0x00,  // 0x202: SE V2, 0 (Rewrites 0x200 the First Pass)
+        0x12, 0x04,  // 0x204: JP 0x204
+        0x72, 0x01,  // 0x206: ADD V2, 1
+        0xA2, 0x01,  // 0x208: LD I, 0x201
+        0x60, 0x05,  // 0x20A: LD V0, 5
+        0xF0, 0x55,  // 0x20C: LD [I], V0
+        0x22, 0x80,  // 0x20E: CALL 0x280 (Page 10, never Written)
+        0x12, 0x00,  // 0x210: JP 0x200
+    };
+    rom[0x80] = 0x73; rom[0x81] = 0x07;  // 0x280: ADD V3, 7
+    rom[0x82] = 0x00; rom[0x83] = 0xEE;  // 0x282: RET
+
+    CHIP8 cpu;
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+    cpu.step(16);
+    CHECK(cpu.getMemVal(0x201) == 0x05);
+    CHECK(cpu.getRegisterVal(0x1) == 0x05);
+    CHECK(cpu.getRegisterVal(0x3) == 0x07);
+    uint64_t firstRun = cpu.hashState();
+
+    CHIP8 fresh;
+    CHECK(fresh.loadROM(rom, sizeof(rom)));
+    cpu.reset();
+    CHECK(cpu.hashState() == fresh.hashState());
+    CHECK(cpu.getMemVal(0x201) == 0x01);
+    CHECK(cpu.getProgramCounter() == 0x200);
+
+    // Stale Decode of 0x200 (LD V1, 5) is Dropped
+    cpu.step(1);
+    CHECK(cpu.getRegisterVal(0x1) == 0x01);
+
+    cpu.step(15);
+    CHECK(cpu.hashState() == firstRun);
+}
+
+
+/**
+ * The same Seed gives the same CXKK Sequence on every Core
+ *  and again after reset, Different Seeds give another
+ */
+static void testSeedRepeatsRandomSequence() {
+    const u_char rom[] = {
+        0xC0, 0xFF,  // RND V0, 0xFF
+        0xC1, 0xFF,  // RND V1, 0xFF
+        0xC2, 0xFF,  // RND V2, 0xFF
+        0xC3, 0xFF,  // RND V3, 0xFF
+        0xC4, 0x0F,  // RND V4, 0x0F
+        0x12, 0x0A,  // JP 0x20A
+    };
+
+    auto sequence = [&](CHIP8 &cpu) {
+        cpu.step(5);
+        uint64_t values = 0x0;
+        for (u_char i = 0x0; i <= 0x4; i++)
+            values = (values << 8) | cpu.getRegisterVal(i);
+        return values;
+    };
+
+    for (uint64_t seed : {uint64_t(0), uint64_t(1), uint64_t(0xDEADBEEF)}) {
+        CHIP8 first, second;
+        first.seed(seed);
+        CHECK(first.loadROM(rom, sizeof(rom)));
+        CHECK(second.loadROM(rom, sizeof(rom)));
+        second.seed(seed);  // Seeding after Loading gives the same
+
+        uint64_t values = sequence(first);
+        CHECK(sequence(second) == values);
+        CHECK((values & 0xF0) == 0x00);  // KK Masks the Byte
+
+        first.reset();
+        CHECK(sequence(first) == values);
+
+        CHIP8 other;
+        CHECK(other.loadROM(rom, sizeof(rom)));
+        other.seed(seed + 1);
+        CHECK(sequence(other) != values);
+    }
+}
+
+
+/**
+ * Runs the ROM for every Instruction Budget up to steps through
+ *  the Decode Cache (step, Fused) and the Interpreter (run, one
+ *  Opcode at a time), Checking they End in the same State. Budgets
+ *  End Mid-Pair as often as not
+ */
+static bool matchesInterpreter(const u_char *rom, size_t size, int steps) {
+    bool isMatched = true;
+    for (int budget = 1; budget <= steps; budget++) {
+        CHIP8 fused, plain;
+        fused.loadROM(rom, size);
+        plain.loadROM(rom, size);
+
+        fused.step(budget);
+        for (int i = 0; i < budget; i++)
+            plain.run(true);
+        if (fused.hashState() != plain.hashState()) {
+            cerr << "Budget " << budget << " Diverged at PC " << hex << plain.getProgramCounter() << dec << '\n';
+            isMatched = false;
+        }
+    }
+    return isMatched;
+}
+
+
+/**
+ * Every Fused Pair Runs the same as it's 2 Opcodes
+ */
+static void testFusedPairsMatchUnfused() {
+    const u_char rom[] = {
+        0x60, 0x05,  // 0x200: LD V0, 5      ] LD_LD
+        0x61, 0xFF,  // 0x202: LD V1, 0xFF   ]
+        0x70, 0x01,  // 0x204: ADD V0, 1     ] ADD_SE (Skips)
+        0x30, 0x06,  // 0x206: SE V0, 6      ]
+        0x12, 0x00,  // 0x208: JP 0x200
+        0x31, 0x00,  // 0x20A: SE V1, 0      ] SE_JP (Doesn't Skip)
+        0x12, 0x0E,  // 0x20C: JP 0x20E      ]
+        0x40, 0x06,  // 0x20E: SNE V0, 6     ] SNE_JP (Doesn't Skip)
+        0x12, 0x12,  // 0x210: JP 0x212      ]
+        0xA3, 0x00,  // 0x212: LD I, 0x300   ] LD_I_ADD_I
+        0xF0, 0x1E,  // 0x214: ADD I, V0     ]
+        0xA2, 0x00,  // 0x216: LD I, 0x200   ] LD_I_DRW
+        0xD0, 0x12,  // 0x218: DRW V0, V1, 2 ]
+        0x6E, 0x0F,  // 0x21A: LD VE, 0xF    ] LD_SKNP (Skips, Key F is Up)
+        0xEE, 0xA1,  // 0x21C: SKNP VE       ]
+        0x12, 0x00,  // 0x21E: JP 0x200
+        0x12, 0x20,  // 0x220: JP 0x220
+    };
+    CHECK(matchesInterpreter(rom, sizeof(rom), 20));
+}
+
+
+/**
+ * Flag Writes Skipped because the Next Instruction Overwrites VF
+ *  must still Land when the Budget Ends between the two
+ */
+static void testLazyFlagsMatchUnfused() {
+    const u_char rom[] = {
+        0x60, 0xF0,  // 0x200: LD V0, 0xF0
+        0x61, 0x20,  // 0x202: LD V1, 0x20
+        0x80, 0x14,  // 0x204: ADD V0, V1 (VF = 1)  ] NF, VF Overwritten by
+        0x6F, 0x07,  // 0x206: LD VF, 7             ]
+        0x80, 0x15,  // 0x208: SUB V0, V1 (VF = 0)  ] NF
+        0x8F, 0x10,  // 0x20A: LD VF, V1            ]
+        0x80, 0x06,  // 0x20C: SHR V0 (VF = 0)      ] NF
+        0xCF, 0xFF,  // 0x20E: RND VF, 0xFF         ]
+        0x81, 0x07,  // 0x210: SUBN V1, V0 (VF = 1) ] NF
+        0xFF, 0x07,  // 0x212: LD VF, DT            ]
+        0x80, 0x0E,  // 0x214: SHL V0 (VF = 0)      ] NF
+        0x80, 0x14,  // 0x216: ADD V0, V1           ] Chained, NF
+        0x80, 0x1E,  // 0x218: SHL V0               ]
+        0xFF, 0x65,  // 0x21A: LD VF, [I]           ]
+        0x12, 0x1C,  // 0x21C: JP 0x21C
+    };
+    CHECK(matchesInterpreter(rom, sizeof(rom), 16));
+
+    // VF from an ADD whose Overwrite was Cut off by the Budget
+    CHIP8 cpu;
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+    cpu.step(3);
+    CHECK(cpu.getRegisterVal(0x0) == 0x10);
+    CHECK(cpu.getRegisterVal(0xF) == 0x01);
+    cpu.step(1);
+    CHECK(cpu.getRegisterVal(0xF) == 0x07);
+}
+
+
+/**
+ * SUPER-CHIP's DXY0 Draws 16x16 across the 128-bit Row's Word
+ *  Boundary, and Scrolls Move it by Whole Pixels and Rows
+ */
+static void testSuperChipScrollAndDraw() {
+    u_char rom[0x40] = {
+        0x00, 0xFF,  // 0x200: HIGH
+        0xA2, 0x20,  // 0x202: LD I, 0x220
+        0x60, 0x3C,  // 0x204: LD V0, 60
+        0x61, 0x00,  // 0x206: LD V1, 0
+        0xD0, 0x10,  // 0x208: DRW V0, V1, 0 (16x16, x = 60-75)
+        0x00, 0xFB,  // 0x20A: SCR (x = 64-79)
+        0x00, 0xFC,  // 0x20C: SCL (x = 60-75)
+        0x00, 0xC4,  // 0x20E: SCD 4 (y = 4-19)
+        0x00, 0xD2,  // 0x210: SCU 2 (y = 2-17)
+        0xD0, 0x10,  // 0x212: DRW V0, V1, 0 (Collides)
+        0x12, 0x14,  // 0x214: JP 0x214
+    };
+    for (int i = 0x20; i < 0x40; i++)
+        rom[i] = 0xFF;  // 0x220: Solid 16x16 Sprite
+
+    // Pixels of a Solid 16x16 Square at (x, y) and none Around it
+    auto isSquareAt = [](const CHIP8 &cpu, int x, int y) {
+        return cpu.getPixel(x, y) && cpu.getPixel(x + 15, y + 15) && cpu.getPixel(x + 15, y) &&
+               !cpu.getPixel(x - 1, y) && !cpu.getPixel(x + 16, y) && !cpu.getPixel(x, y - 1) &&
+               !cpu.getPixel(x, y + 16);
+    };
+
+    for (bool isInterpreted : {false, true}) {
+        CHIP8 cpu;
+        CHECK(cpu.loadROM(rom, sizeof(rom)));
+        auto advance = [&](int count) {
+            for (int i = 0; i < count; i++) {
+                if (isInterpreted) cpu.run(true);
+                else cpu.step(1);
+            }
+        };
+
+        advance(5);
+        CHECK(cpu.isHires());
+        CHECK(isSquareAt(cpu, 60, 0));
+        CHECK(cpu.getRegisterVal(0xF) == 0x00);
+
+        advance(1);
+        CHECK(isSquareAt(cpu, 64, 0));
+        advance(1);
+        CHECK(isSquareAt(cpu, 60, 0));
+        advance(1);
+        CHECK(isSquareAt(cpu, 60, 4));
+        advance(1);
+        CHECK(isSquareAt(cpu, 60, 2));
+
+        // Drawn over at y = 0, Rows 2-15 Clear and 0-1, 16-17 are Left
+        advance(1);
+        CHECK(cpu.getRegisterVal(0xF) == 0x01);
+        CHECK(cpu.getPixel(60, 0) && cpu.getPixel(75, 1) && cpu.getPixel(60, 16) && cpu.getPixel(75, 17));
+        CHECK(!cpu.getPixel(60, 2) && !cpu.getPixel(75, 15) && !cpu.getPixel(60, 18));
+    }
+}
+
+
+/**
+ * Short Tones run Out within the Frame that Set them (Timers
+ *  Count per Instruction), the Buzzer must still Sound for it
+ */
+static void testShortToneSounds() {
+    const u_char rom[] = {
+        0x60, 0x02,  // LD V0, 2
+        0xF0, 0x18,  // LD ST, V0
+        0x12, 0x04,  // JP 0x204
+    };
+
+    CHIP8 cpu;
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+    CHECK(!cpu.isSoundOn());
+
+    cpu.runFrame(4);
+    CHECK(cpu.get_sTimer() == 0);
+    CHECK(cpu.isSoundOn());
+
+    // Next Frame is Silent once the Reader Clears the Flag
+    cpu.soundFlag = false;
+    cpu.runFrame(4);
+    CHECK(!cpu.isSoundOn());
+}
+
+
+/**
+ * setState Marks the Page before a Changed Page Dirty, so a Fused
+ *  Pair Decoded across the Boundary is Dropped by reset
+ */
+static void testSetStateDropsFusedAcrossPages() {
+    u_char rom[0x44] = {
+        0x12, 0x3E,  // JP 0x23E
+    };
+    rom[0x3E] = 0x60; rom[0x3F] = 0x01;  // 0x23E: LD V0, 1   (Last Word of Page 8)
+    rom[0x40] = 0x61; rom[0x41] = 0x02;  // 0x240: LD V1, 2   (First Word of Page 9, Fuses with the Above)
+    rom[0x42] = 0x12; rom[0x43] = 0x42;  // 0x242: JP 0x242
+
+    CHIP8 cpu;
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+
+    // Change only Page 9's First Byte: LD V1, 2 -> LD V2, 2
+    CHIP8State changed = cpu.getState();
+    changed.memory[0x240] = 0x62;
+    cpu.setState(changed);
+
+    cpu.step(4);
+    CHECK(cpu.getRegisterVal(0x2) == 0x02);
+
+    // Boot Image's LD V1, 2 must Run again, not the Stale Fused Pair
+    cpu.reset();
+    cpu.step(4);
+    CHECK(cpu.getMemVal(0x240) == 0x61);
+    CHECK(cpu.getRegisterVal(0x1) == 0x02);
+    CHECK(cpu.getRegisterVal(0x2) == 0x00);
+}
+
+
+/**
+ * One Core Swapping two States in and out Runs each as its own
+ *  Core would, even where their Self-Modified Code Differs under
+ *  a Fused Pair Decoded across a Page Boundary
+ */
+static void testLoadStateSharesDecodes() {
+    u_char rom[0x44] = {
+        0xC0, 0xFF,  // 0x200: RND V0, 0xFF
+        0xA2, 0x41,  // 0x202: LD I, 0x241
+        0xF0, 0x55,  // 0x204: LD [I], V0 (Rewrites 0x240's Byte)
+        0x82, 0x14,  // 0x206: ADD V2, V1
+        0x12, 0x3E,  // 0x208: JP 0x23E
+    };
+    rom[0x3E] = 0x6F; rom[0x3F] = 0x00;  // 0x23E: LD VF, 0  (Last Word of Page 8)
+    rom[0x40] = 0x61; rom[0x41] = 0x00;  // 0x240: LD V1, KK (Self-Modified, Fuses with the Above)
+    rom[0x42] = 0x12; rom[0x43] = 0x00;  // 0x242: JP 0x200
+
+    CHIP8 runner;
+    CHECK(runner.loadROM(rom, sizeof(rom)));
+
+    CHIP8 cores[2] = {runner, runner};
+    CHIP8State states[2];
+    uint64_t dirtyPages[2] = {0x0, 0x0};
+    for (int k = 0; k < 2; k++) {
+        cores[k].seed(k + 1);
+        states[k] = cores[k].getState();
+    }
+
+    for (int round = 0; round < 40; round++) {
+        for (int k = 0; k < 2; k++) {
+            runner.loadState(states[k], dirtyPages[k]);
+            runner.step(round % 5 + 1);
+            dirtyPages[k] = runner.saveState(states[k]);
+
+            cores[k].step(round % 5 + 1);
+            CHECK(runner.hashState() == cores[k].hashState());
+        }
+    }
+    CHECK(states[0].memory[0x241] != states[1].memory[0x241]);
+}
+
+
+/**
+ * Skipping a Literal F000 Word is 2 Bytes in CHIP-8 Mode,
+ *  only XO-CHIP Steps over all of F000 NNNN
+ */
+static void testSkipOverF000ByMode() {
+    const u_char rom[] = {
+        0x30, 0x00,  // SE V0, 0 (Always Skips)
+        0xF0, 0x00,  // F000 (LD I, long in XO-CHIP)
+        0x61, 0x01,  // LD V1, 1 (CHIP-8 Lands here)
+        0x62, 0x01,  // LD V2, 1 (XO-CHIP Lands here)
+        0x12, 0x08,  // JP 0x208
+    };
+
+    CHIP8 cpu;
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+    cpu.step(1);
+    CHECK(cpu.getProgramCounter() == 0x204);
+    cpu.step(3);
+    CHECK(cpu.getRegisterVal(0x1) == 0x01);
+    CHECK(cpu.getRegisterVal(0x2) == 0x01);
+
+    CHIP8 xo;
+    xo.setMode(MODE_XO_CHIP);
+    CHECK(xo.loadROM(rom, sizeof(rom)));
+    xo.step(1);
+    CHECK(xo.getProgramCounter() == 0x206);
+    xo.step(2);
+    CHECK(xo.getRegisterVal(0x1) == 0x00);
+    CHECK(xo.getRegisterVal(0x2) == 0x01);
+}
+
+
+/**
+ * XO-CHIP Opcodes are NOPs in CHIP-8 Mode, so Falling through
+ *  F000 Runs it's NNNN Word, the same as Skipping onto it. The
+ *  Decode Cache (step) and the Interpreter (run) must Agree
+ */
+static void testXoOpcodesByMode() {
+    const u_char rom[] = {
+        0xF0, 0x00,  // F000 (LD I, long in XO-CHIP)
+        0x61, 0x03,  // LD V1, 3 (NNNN in XO-CHIP)
+        0x62, 0x04,  // LD V2, 4
+        0x50, 0x12,  // 5012 (Store V0-V1 at I in XO-CHIP)
+        0xF3, 0x3A,  // F33A (PITCH V3 in XO-CHIP)
+        0x12, 0x0A,  // JP 0x20A
+    };
+
+    for (bool isInterpreted : {false, true}) {
+        CHIP8 cpu;
+        CHECK(cpu.loadROM(rom, sizeof(rom)));
+        for (int i = 0; i < 6; i++) {
+            if (isInterpreted) cpu.run(true);
+            else cpu.step(1);
+        }
+        CHECK(cpu.getIndexReg() == 0x000);
+        CHECK(cpu.getRegisterVal(0x1) == 0x03);
+        CHECK(cpu.getRegisterVal(0x2) == 0x04);
+        CHECK(cpu.getProgramCounter() == 0x20A);
+
+        CHIP8 xo;
+        xo.setMode(MODE_XO_CHIP);
+        CHECK(xo.loadROM(rom, sizeof(rom)));
+        for (int i = 0; i < 5; i++) {
+            if (isInterpreted) xo.run(true);
+            else xo.step(1);
+        }
+        CHECK(xo.getIndexReg() == 0x6103);
+        CHECK(xo.getRegisterVal(0x1) == 0x00);
+        CHECK(xo.getRegisterVal(0x2) == 0x04);
+        CHECK(xo.getProgramCounter() == 0x20A);
+    }
+}
+
+
+/**
+ * XO-CHIP Cores Clone like CHIP-8 ones, Restoring brings back
+ *  Memory Written past 4KB (Run-Ahead Clones on the Audio Thread)
+ */
+static void testCloneRestoresXoMemory() {
+    const u_char rom[] = {
+        0xF0, 0x00, 0x80, 0x00,  // LD I, 0x8000
+        0x60, 0x11,              // LD V0, 0x11
+        0x61, 0x01,              // LD V1, 1
+        0xF0, 0x55,              // LD [I], V0
+        0xF1, 0x1E,              // ADD I, V1
+        0x70, 0x01,              // ADD V0, 1
+        0x12, 0x08,              // JP 0x208
+    };
+
+    CHIP8 cpu;
+    cpu.setMode(MODE_XO_CHIP);
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+
+    CloneArena arena(cpu);
+    arena.reserveClones(1);
+    cpu.step(4);
+    const CoreClone *saved = cpu.clone(arena);
+    CHECK(saved != nullptr);
+    uint64_t hash = cpu.hashState();
+
+    cpu.step(30);
+    CHECK(cpu.getMemVal(0x8001) != 0x00);
+    cpu.restore(arena, saved);
+    CHECK(cpu.hashState() == hash);
+    CHECK(cpu.getMemVal(0x8000) == 0x11);
+    CHECK(cpu.getMemVal(0x8001) == 0x00);
+}
+
+
+/**
+ * A Key Observer Sees each Key Read without a Provider,
+ *  Keys are still Read as Set
+ */
+static u_int16_t observedMask = 0x0;
+static int observedReads = 0;
+
+static void observeKeys(u_int16_t mask, void *) {
+    observedMask = mask;
+    observedReads++;
+}
+
+static void testKeyObserverSeesSetKeys() {
+    const u_char rom[] = {
+        0x60, 0x05,  // LD V0, 5
+        0xE0, 0x9E,  // SKP V0
+        0x61, 0x01,  // LD V1, 1 (Skipped while Key 5 is Down)
+        0x12, 0x06,  // JP 0x206
+    };
+
+    CHIP8 cpu;
+    CHECK(cpu.loadROM(rom, sizeof(rom)));
+    cpu.setKeyObserver(observeKeys, nullptr);
+    cpu.key[0x5] = true;
+
+    cpu.step(3);
+    CHECK(observedReads == 1);
+    CHECK(observedMask == 0x1 << 0x5);
+    CHECK(cpu.getRegisterVal(0x1) == 0x00);
+    CHECK(cpu.getKeyReadTime() == 0);  // Nothing was Latched
+}
+
+
+/**
+ * Snapshots Hold Machine State only, Restoring one Brings back
+ *  the State and XO-CHIP Memory past 4KB
+ */
+static void testSnapshotRestores() {
+    const u_char rom[] = {
+        0xF0, 0x00, 0x80, 0x00,  // LD I, 0x8000
+        0x61, 0x01,              // LD V1, 1
+        0xF0, 0x55,              // LD [I], V0
+        0xF1, 0x1E,              // ADD I, V1
+        0x70, 0x01,              // ADD V0, 1
+        0x12, 0x06,              // JP 0x206
+    };
+
+    for (int mode : {YAC8_MODE_CHIP8, YAC8_MODE_XO_CHIP}) {
+        yac8_t *core = yac8_create();
+        CHECK(yac8_set_mode(core, mode) == 0);
+        CHECK(yac8_load_rom(core, rom, sizeof(rom)) == 0);
+        yac8_step(core, 10);
+
+        yac8_snapshot_t *snapshot = yac8_snapshot_create(core);
+        CHECK(snapshot != NULL);
+        uint64_t hash = yac8_state_hash(core);
+
+        yac8_step(core, 40);
+        CHECK(yac8_state_hash(core) != hash);
+        CHECK(yac8_snapshot_restore(core, snapshot) == 0);
+        CHECK(yac8_state_hash(core) == hash);
+
+        // Restored Core Runs the same as it did
+        yac8_step(core, 40);
+        uint64_t ahead = yac8_state_hash(core);
+        CHECK(yac8_snapshot_restore(core, snapshot) == 0);
+        yac8_step(core, 40);
+        CHECK(yac8_state_hash(core) == ahead);
+
+        // Snapshots don't Cross Modes
+        yac8_t *other = yac8_create();
+        CHECK(yac8_set_mode(other, mode == YAC8_MODE_CHIP8 ? YAC8_MODE_XO_CHIP : YAC8_MODE_CHIP8) == 0);
+        CHECK(yac8_snapshot_restore(other, snapshot) == -1);
+
+        yac8_destroy(other);
+        yac8_snapshot_destroy(snapshot);
+        yac8_destroy(core);
+    }
+}
+
+
+static const uint32_t envCount = 37, envSteps = 40;  // Instances and Steps runEnv Runs
+
+// Every Observation, Reward, and Done an Environment Returned
+struct EnvTrace {
+    vector<uint64_t> obs;
+    vector<float> rewards;
+    vector<uint8_t> dones;
+};
+
+/**
+ * Runs an Environment over a Fixed Run of Seeds and Actions
+ *
+ * @param threads - Threads Stepping the Instances
+ * @returns Everything reset and step Returned, in Order
+ */
+static EnvTrace runEnv(uint32_t threads) {
+    const u_char rom[] = {
+        0xC0, 0x3F,              // 0x200: RND V0, 0x3F
+        0xC1, 0x1F,              // 0x202: RND V1, 0x1F
+        0xA2, 0x16,              // 0x204: LD I, 0x216
+        0xD0, 0x13,              // 0x206: DRW V0, V1, 3
+        0x62, 0x05,              // 0x208: LD V2, 5
+        0xE2, 0xA1,              // 0x20A: SKNP V2
+        0x73, 0x01,              // 0x20C: ADD V3, 1
+        0xA3, 0x00,              // 0x20E: LD I, 0x300
+        0xF3, 0x55,              // 0x210: LD [I], V3
+        0x12, 0x00,              // 0x212: JP 0x200
+        0x00, 0x00,
+        0xE0, 0xA0, 0xE0,        // 0x216: Sprite
+    };
+    const uint32_t count = envCount, steps = envSteps;
+
+    yac8_env_t *env = yac8_env_create(rom, sizeof(rom), count, threads);
+    CHECK(env != NULL);
+    if (!env) return {};
+    yac8_env_set_max_frames(env, 60);
+    CHECK(yac8_env_add_reward(env, 0x300, 0.5f) == 0);  // V0, Random
+    CHECK(yac8_env_add_reward(env, 0x303, 1.0f) == 0);  // V3, Counts Key 5 Frames
+    CHECK(yac8_env_add_done(env, 0x303, 200) == 0);
+
+    EnvTrace trace;
+    trace.obs.resize((steps + 1) * count * YAC8_ENV_OBS_WORDS);
+    trace.rewards.resize(steps * count);
+    trace.dones.resize(steps * count);
+
+    vector<uint64_t> seeds(count);
+    for (uint32_t i = 0; i < count; i++)
+        seeds[i] = i * 13 + 1;
+    yac8_env_reset(env, seeds.data(), trace.obs.data());
+
+    vector<uint16_t> actions(count);
+    for (uint32_t step = 0; step < steps; step++) {
+        for (uint32_t i = 0; i < count; i++)
+            actions[i] = uint16_t(1 << ((i * 3 + step) % 16)) | ((i + step) % 3 ? 0x0 : 0x20);
+        yac8_env_step(env, actions.data(), trace.obs.data() + (step + 1) * count * YAC8_ENV_OBS_WORDS,
+                      trace.rewards.data() + step * count, trace.dones.data() + step * count);
+    }
+
+    yac8_env_destroy(env);
+    return trace;
+}
+
+
+/**
+ * Same Seeds and Actions give the same Observations, Rewards,
+ *  and Dones, however many Threads Step the Instances
+ */
+static void testEnvMatchesAcrossThreads() {
+    EnvTrace single = runEnv(1);
+    EnvTrace pooled = runEnv(3);
+    CHECK(single.obs.size() && single.obs == pooled.obs);
+    CHECK(single.rewards.size() && memcmp(single.rewards.data(), pooled.rewards.data(),
+                                          single.rewards.size() * sizeof(float)) == 0);
+    CHECK(single.dones.size() && single.dones == pooled.dones);
+    CHECK(runEnv(3).obs == pooled.obs);
+
+    // Instances Diverge, and some Episodes End, so the Trace isn't Trivial
+    const uint64_t *first = &single.obs[envCount * YAC8_ENV_OBS_WORDS];  // First Step's, after the Reset's
+    CHECK(memcmp(first, first + YAC8_ENV_OBS_WORDS, YAC8_ENV_OBS_WORDS * sizeof(uint64_t)) != 0);
+    bool isAnyDone = false, isAnyRewarded = false;
+    for (size_t i = 0; i < single.dones.size(); i++) {
+        isAnyDone = isAnyDone || single.dones[i];
+        isAnyRewarded = isAnyRewarded || single.rewards[i] != 0.0f;
+    }
+    CHECK(isAnyDone && isAnyRewarded);
+}
+
+
+
+/**
+ * Observations Hold SUPER-CHIP's 128x64 Display, not
+ *  just the Top Left 64x32 of it
+ */
+static void testEnvObservesHires() {
+    const u_char rom[] = {
+        0x00, 0xFF,  // 0x200: HIGH
+        0xA2, 0x0C,  // 0x202: LD I, 0x20C
+        0x60, 0x64,  // 0x204: LD V0, 100
+        0x61, 0x28,  // 0x206: LD V1, 40
+        0xD0, 0x11,  // 0x208: DRW V0, V1, 1
+        0x12, 0x0A,  // 0x20A: JP 0x20A
+        0x80,        // 0x20C: Sprite, Leftmost Pixel
+    };
+
+    yac8_env_t *env = yac8_env_create(rom, sizeof(rom), 2, 1);
+    CHECK(env != NULL);
+    if (!env) return;
+
+    uint64_t obs[2 * YAC8_ENV_OBS_WORDS];
+    const uint16_t actions[2] = {0x0, 0x0};
+    yac8_env_reset(env, NULL, obs);
+    yac8_env_step(env, actions, obs, NULL, NULL);
+
+    // (100, 40) is Row 40's Right Word, Bit 63 - (100 - 64)
+    for (int k = 0; k < 2; k++) {
+        const uint64_t *rows = obs + k * YAC8_ENV_OBS_WORDS;
+        CHECK(rows[40 * 2 + 1] == 1ULL << 27);
+        for (int word = 0; word < YAC8_ENV_OBS_WORDS; word++)
+            CHECK(word == 40 * 2 + 1 || rows[word] == 0x0);
+    }
+    yac8_env_destroy(env);
+}
+
+
+int main() {
+    testStackFaults();
+    testResetRestoresBootImage();
+    testSeedRepeatsRandomSequence();
+    testFusedPairsMatchUnfused();
+    testLazyFlagsMatchUnfused();
+    testSuperChipScrollAndDraw();
+    testShortToneSounds();
+    testSetStateDropsFusedAcrossPages();
+    testLoadStateSharesDecodes();
+    testSkipOverF000ByMode();
+    testXoOpcodesByMode();
+    testCloneRestoresXoMemory();
+    testKeyObserverSeesSetKeys();
+    testSnapshotRestores();
+    testEnvMatchesAcrossThreads();
+    testEnvObservesHires();
+
+    if (failures) {
+        cerr << failures << " Check(s) Failed\n";
+        return 1;
+    }
+    cout << "All Checks Passed\n";
+    return 0;
+}
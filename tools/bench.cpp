@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "../include/CHIP-8.h"
+#include "../include/Disassembler.h"
+#include "bench.h"
+
+#define BENCH_FRAMES 10000  // Frames Run per ROM (Default)
+#define BENCH_IPF 100       // Instructions per Frame (Default)
+#define BENCH_MICRO 1000000 // Iterations per Microbenchmark (Default)
+#define MOVIE_SEED 0xC8     // Seed of the Scripted Input Movie
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/**
+ * Returns the Peak Resident Set Size in KB
+ */
+static long peakRSS() {
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Scripted Input Movie, Key Mask to hold for the Frame
+ *  Holds a Pseudo-Random Key for 8 Frames then Releases
+ *  for 8 Frames, same Sequence every Run
+ * 
+ * @param frame - Frame Index
+ */
+static u_int16_t movieKeys(u_int32_t frame) {
+    if ((frame >> 3) & 0x1) return 0x0;
+    u_int32_t h = (frame >> 4) * 0x9E3779B1u + MOVIE_SEED;
+    return u_int16_t(1 << ((h >> 28) & 0xF));
+}
+
+/**
+ * Runs a ROM Headless for a Fixed Number of Frames
+ * 
+ * @param romPath - Path to the ROM
+ * @param frames - Frames to Run
+ * @param ipf - Instructions per Frame
+ * @param res - Filled with the Result
+ * @returns False if the ROM could not be Loaded
+ */
+static bool benchROM(const fs::path &romPath, u_int32_t frames, u_int32_t ipf, BenchResult &res) {
+    Disassembler dasm;
+    vector<u_char> rom;
+    string pathStr = romPath.string();
+    if (!dasm.readROM(&pathStr[0], rom))
+        return false;
+
+    CHIP8 cpu;
+    cpu.seed(MOVIE_SEED);  // Same RND Sequence every Run
+    if (!cpu.loadROM(rom.data(), rom.size()))
+        return false;
+    cpu.prewarm(dasm.analyze(rom.data(), u_int16_t(rom.size())));
+
+    auto startTime = chrono::steady_clock::now();
+    for (u_int32_t frame = 0; frame < frames; frame++) {
+        u_int16_t keys = movieKeys(frame);
+        for (u_char i = 0x0; i <= 0xF; i++)
+            cpu.key[i] = (keys >> i) & 0x1;
+
+        cpu.runFrame(ipf);
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+    res.name = romPath.filename().string();
+    res.ops = u_int64_t(frames) * ipf;
+    res.nsPerOp = elapsed * 1e9 / res.ops;
+    res.opsPerSecond = res.ops / elapsed;
+    res.framesPerSecond = frames / elapsed;
+    return true;
+}
+
+/**
+ * Reads nsPerOp by Name from a Previous JSON Output
+ * 
+ * @param path - Path to the Baseline JSON
+ * @param baseline - Filled with nsPerOp by Benchmark Name
+ * @returns False if the File could not be Read
+ */
+static bool readBaseline(const char *path, map<string, double> &baseline) {
+    ifstream file(path);
+    if (!file) return false;
+
+    // Output is one Result Object per Line
+    string line;
+    while (getline(file, line)) {
+        size_t namePos = line.find("\"name\": \"");
+        size_t nsPos = line.find("\"nsPerOp\": ");
+        if (namePos == string::npos || nsPos == string::npos) continue;
+
+        namePos += 9;
+        string name = line.substr(namePos, line.find('"', namePos) - namePos);
+        baseline[name] = stod(line.substr(nsPos + 11));
+    }
+    return true;
+}
+
+/**
+ * Outputs the Results as JSON, one Result Object per Line
+ */
+static void writeJSON(ostream &out, u_int32_t frames, u_int32_t ipf,
+                      const vector<BenchResult> &roms, const vector<BenchResult> &micro) {
+    auto writeList = [&](const vector<BenchResult> &list) {
+        for (size_t i = 0; i < list.size(); i++) {
+            const BenchResult &r = list[i];
+            out << "    {\"name\": \"" << r.name << "\", \"ops\": " << r.ops
+                << ", \"nsPerOp\": " << r.nsPerOp << ", \"opsPerSecond\": " << r.opsPerSecond
+                << ", \"framesPerSecond\": " << r.framesPerSecond << "}"
+                << (i + 1 < list.size() ? ",\n" : "\n");
+        }
+    };
+
+    out << "{\n"
+        << "  \"frames\": " << frames << ",\n"
+        << "  \"ipf\": " << ipf << ",\n"
+        << "  \"peakRSSKB\": " << peakRSS() << ",\n"
+        << "  \"roms\": [\n";
+    writeList(roms);
+    out << "  ],\n"
+        << "  \"micro\": [\n";
+    writeList(micro);
+    out << "  ]\n"
+        << "}\n";
+}
+
+int main(int argc, char **argv) {
+    // Argument Variables
+    const char *romDir = "roms";
+    char *jsonOutput = NULL;
+    char *baselinePath = NULL;
+    u_int32_t frames = BENCH_FRAMES;
+    u_int32_t ipf = BENCH_IPF;
+    unsigned long long microIterations = BENCH_MICRO;
+    double threshold = 5.0;
+
+    // Check Arguments
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            cout << "Usage: yac8_bench {romDir} [OPTIONS]\n\n"
+                 << "INFO:\n"
+                 << "romDir \t\t\t Directory of ROMs to Run (Default 'roms')\n\n"
+
+                 << "OPTIONS:\n"
+                 << "-h, --help \t\t Outputs Help Manual\n"
+                 << "--frames [count] \t Frames to Run per ROM\n"
+                 << "--ipf [count] \t\t Instructions per Frame\n"
+                 << "--micro [count] \t Iterations per Microbenchmark\n"
+                 << "--json [path] \t\t Writes Results as JSON\n"
+                 << "--baseline [path] \t Compares against a Previous JSON Output\n"
+                 << "--threshold [pct] \t Slowdown that Counts as a Regression (Default 5)\n";
+            exit(0);
+        } else if (arg == "--frames" && (i + 1) < argc) {
+            frames = stoul(argv[++i]);
+        } else if (arg == "--ipf" && (i + 1) < argc) {
+            ipf = stoul(argv[++i]);
+        } else if (arg == "--micro" && (i + 1) < argc) {
+            microIterations = stoull(argv[++i]);
+        } else if (arg == "--json" && (i + 1) < argc) {
+            jsonOutput = argv[++i];
+        } else if (arg == "--baseline" && (i + 1) < argc) {
+            baselinePath = argv[++i];
+        } else if (arg == "--threshold" && (i + 1) < argc) {
+            threshold = stod(argv[++i]);
+        } else {
+            romDir = argv[i];
+        }
+    }
+
+    if (frames == 0 || ipf == 0 || microIterations == 0) {
+        cerr << "Frames, IPF, and Micro Iterations must be greater than 0!\n";
+        exit(1);
+    }
+
+    // Gather ROMs (Sorted for Stable Output)
+    error_code err;
+    vector<fs::path> roms;
+    for (const auto &entry : fs::directory_iterator(romDir, err))
+        if (entry.is_regular_file()) roms.push_back(entry.path());
+    if (err) {
+        cerr << "Failed to Read '" << romDir << "': " << err.message() << '\n';
+        exit(1);
+    }
+    sort(roms.begin(), roms.end());
+
+    // ROM Suite
+    vector<BenchResult> romResults;
+    for (const fs::path &romPath : roms) {
+        BenchResult res;
+        if (benchROM(romPath, frames, ipf, res))
+            romResults.push_back(res);
+        else
+            cerr << "Skipping '" << romPath.string() << "'\n";
+    }
+
+    // Microbenchmarks
+    vector<BenchResult> microResults = runMicroBenchmarks(microIterations);
+
+    // Output Table
+    printf("%-20s %14s %10s %12s\n", "Benchmark", "Ops/s", "ns/Op", "Frames/s");
+    for (const auto *list : {&romResults, &microResults})
+        for (const BenchResult &r : *list)
+            printf("%-20s %14.0f %10.3f %12.1f\n", r.name.c_str(), r.opsPerSecond, r.nsPerOp, r.framesPerSecond);
+    printf("Peak RSS: %ld KB\n", peakRSS());
+
+    if (jsonOutput) {
+        ofstream file(jsonOutput);
+        writeJSON(file, frames, ipf, romResults, microResults);
+    }
+
+    // Compare against Baseline
+    int regressions = 0;
+    if (baselinePath) {
+        map<string, double> baseline;
+        if (!readBaseline(baselinePath, baseline)) {
+            cerr << "Failed to Read Baseline '" << baselinePath << "'\n";
+            exit(1);
+        }
+
+        printf("\n%-20s %10s %10s %9s\n", "Benchmark", "Base ns", "ns", "Change");
+        for (const auto *list : {&romResults, &microResults}) {
+            for (const BenchResult &r : *list) {
+                auto base = baseline.find(r.name);
+                if (base == baseline.end() || base->second <= 0) continue;
+
+                double change = (r.nsPerOp - base->second) / base->second * 100.0;
+                bool isRegression = change > threshold;
+                regressions += isRegression;
+                printf("%-20s %10.3f %10.3f %+8.1f%%%s\n", r.name.c_str(), base->second, r.nsPerOp, change,
+                       isRegression ? "  REGRESSION" : "");
+            }
+        }
+    }
+
+    return regressions ? 1 : 0;
+}
@@ -0,0 +1,20 @@
+#ifndef YAC8_INTERPRETER_BENCH_H
+#define YAC8_INTERPRETER_BENCH_H
+
+#include <string>
+#include <vector>
+
+// Result of a Single Benchmark
+struct BenchResult {
+    std::string name;        // ROM or Microbenchmark Name
+    double nsPerOp;          // Nanoseconds per Instruction/Operation
+    double opsPerSecond;     // Instructions/Operations per Second
+    double framesPerSecond;  // Frames per Second (ROMs Only)
+    unsigned long long ops;  // Instructions/Operations Run
+};
+
+// Runs the Core Microbenchmarks (DRW, CLS, Decode, Framebuffer Conversion)
+std::vector<BenchResult> runMicroBenchmarks(unsigned long long iterations);
+
+
+#endif  //YAC8_INTERPRETER_BENCH_H
@@ -0,0 +1,124 @@
+#include <chrono>
+
+#include "../include/CHIP-8.h"
+#include "../include/CloneArena.h"
+#include "../include/yac8.h"
+#include "bench.h"
+
+/**
+ * Times the given Operation over a number of Iterations
+ * 
+ * @param name - Name of the Benchmark
+ * @param iterations - Number of times to run the Operation
+ * @param fn - Operation, given the Iteration Index
+ */
+template <typename Fn>
+static BenchResult timeOp(const char *name, unsigned long long iterations, Fn fn) {
+    auto startTime = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < iterations; i++)
+        fn(i);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    BenchResult res;
+    res.name = name;
+    res.ops = iterations;
+    res.nsPerOp = elapsed * 1e9 / iterations;
+    res.opsPerSecond = iterations / elapsed;
+    res.framesPerSecond = 0;
+    return res;
+}
+
+/**
+ * Runs the Microbenchmarks on the Core's Hot Operations
+ * 
+ * @param iterations - Iterations per Microbenchmark
+ */
+std::vector<BenchResult> runMicroBenchmarks(unsigned long long iterations) {
+    std::vector<BenchResult> results;
+    volatile u_int32_t sink = 0;  // Keeps Results Observable
+
+    // DRW: 15 Row Sprite from the Font Area at Moving Positions
+    {
+        CHIP8 cpu;
+        cpu.LD(u_int16_t(0x0));
+        results.push_back(timeOp("DRW", iterations, [&](unsigned long long i) {
+            u_char x = i & 0x3F, y = (i >> 6) & 0x1F;
+            cpu.DRW(&x, &y, 0xF);
+        }));
+        sink = sink + cpu.getRegisterVal(0xF);
+    }
+
+    // CLS
+    {
+        CHIP8 cpu;
+        results.push_back(timeOp("CLS", iterations, [&](unsigned long long) {
+            cpu.CLS();
+        }));
+        sink = sink + cpu.drawFlag;
+    }
+
+    // Reset: Restore Boot Image of a ROM that Wrote Memory (FX55)
+    {
+        static const u_char rom[] = {0xA3, 0x00, 0xFF, 0x55, 0x12, 0x00};  // LD I, 0x300; LD [I], VF; JP 0x200
+        CHIP8 cpu;
+        cpu.loadROM(rom, sizeof(rom));
+        results.push_back(timeOp("Reset", iterations, [&](unsigned long long) {
+            cpu.step(3);
+            cpu.reset();
+        }));
+        sink = sink + cpu.getProgramCounter();
+    }
+
+    // Clone/Restore: Tree Search's Expand and Revisit, Arena Cleared as a Search would
+    {
+        static const u_char rom[] = {0xA3, 0x00, 0xFF, 0x55, 0x12, 0x00};  // LD I, 0x300; LD [I], VF; JP 0x200
+        CHIP8 cpu;
+        cpu.loadROM(rom, sizeof(rom));
+        cpu.step(3);
+        CloneArena arena(cpu);
+        const CoreClone *parent = nullptr;
+        results.push_back(timeOp("Clone", iterations, [&](unsigned long long i) {
+            if ((i & 0x3FF) == 0) {
+                arena.clear();
+                parent = nullptr;
+            }
+            parent = cpu.clone(arena, parent);
+        }));
+
+        const CoreClone *copy = cpu.clone(arena);
+        results.push_back(timeOp("Restore", iterations, [&](unsigned long long) {
+            cpu.restore(arena, copy);
+        }));
+        sink = sink + cpu.getProgramCounter();
+    }
+
+    // Decode: Walks every Opcode
+    results.push_back(timeOp("Decode", iterations, [&](unsigned long long i) {
+        sink = sink + CHIP8::decode(u_int16_t(i * 0x9E37)).op;
+    }));
+
+    // Framebuffer Conversion: Display to 32-bit Pixels (as Display::Draw does)
+    {
+        CHIP8 cpu;
+        static const u_int32_t palette[4] = {0x000000, 0xFFFFFF, 0xAAAAAA, 0x555555};
+        static u_int32_t pixels[64 * 32];
+        results.push_back(timeOp("FramebufferRGB", iterations, [&](unsigned long long) {
+            compositeDisplay(cpu.getState().display, false, palette, pixels);
+        }));
+        sink = sink + pixels[0];
+    }
+
+    // Framebuffer Conversion: Display Packed to 1-bit Rows (C Interface)
+    {
+        yac8_t *core = yac8_create();
+        uint64_t rows[YAC8_DISPLAY_HEIGHT];
+        results.push_back(timeOp("FramebufferPacked", iterations, [&](unsigned long long) {
+            yac8_get_framebuffer(core, rows);
+        }));
+        sink = sink + u_int32_t(rows[0]);
+        yac8_destroy(core);
+    }
+
+    (void)sink;
+    return results;
+}
@@ -0,0 +1,172 @@
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/CHIP-8.h"
+#include "../include/Disassembler.h"
+#include "../include/Hash.h"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/**
+ * Escapes a String to be used as a JSON String Value
+ * 
+ * @param str - String to Escape
+ */
+static string jsonEscape(const string &str) {
+    string res;
+    for (char c : str) {
+        if (c == '"' || c == '\\') res += '\\';
+        if (u_char(c) < 0x20) continue;  // Drop Control Characters
+        res += c;
+    }
+    return res;
+}
+
+/**
+ * Analyzes a Single ROM and Outputs it's JSON Report
+ * 
+ * @param romPath - Path to the ROM
+ * @param out - Output Stream for the JSON Report
+ * @returns False if the ROM could not be Read
+ */
+static bool analyzeROM(const fs::path &romPath, ostream &out) {
+    Disassembler dasm;
+    vector<u_char> rom;
+    string pathStr = romPath.string();
+    if (!dasm.readROM(&pathStr[0], rom))
+        return false;
+
+    // Only what Fits in Memory can be Code
+    u_int16_t size = u_int16_t(min<size_t>(rom.size(), 0x1000 - ROM_START));
+    ProgramMap map = dasm.analyze(rom.data(), size);
+
+    // Static Instruction Mix
+    u_int32_t opCount[OPERATION_COUNT] = {0};
+    u_int32_t instructions = 0, codeBytes = 0, subroutines = 0;
+    for (u_int16_t addr = ROM_START; addr < ROM_START + size; addr++) {
+        u_char type = map.byteMap[addr - ROM_START];
+        if (type != BYTE_DATA) codeBytes++;
+        if (type != BYTE_CODE) continue;
+
+        u_int16_t opcode = (rom[addr - ROM_START] << 8) | rom[addr - ROM_START + 1];
+        opCount[CHIP8::decode(opcode).op]++;
+        instructions++;
+    }
+    for (const auto &block : map.blocks)
+        if (block.second.isSubroutine) subroutines++;
+
+    char hash[17];
+    snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)Hash::hash64(rom.data(), rom.size()));
+
+    out << "{\n"
+        << "  \"name\": \"" << jsonEscape(romPath.filename().string()) << "\",\n"
+        << "  \"path\": \"" << jsonEscape(pathStr) << "\",\n"
+        << "  \"size\": " << rom.size() << ",\n"
+        << "  \"hash\": \"" << hash << "\",\n"
+        << "  \"instructions\": " << instructions << ",\n"
+        << "  \"blocks\": " << map.blocks.size() << ",\n"
+        << "  \"subroutines\": " << subroutines << ",\n"
+        << "  \"codeBytes\": " << codeBytes << ",\n"
+        << "  \"dataBytes\": " << rom.size() - codeBytes << ",\n"
+        << "  \"indirectJump\": " << (map.hasIndirectJump ? "true" : "false") << ",\n"
+        << "  \"opcodes\": {";
+
+    bool isFirst = true;
+    for (size_t op = OP_NOP; op < OPERATION_COUNT; op++) {
+        if (!opCount[op]) continue;
+        out << (isFirst ? "\n" : ",\n") << "    \"" << operationNames[op] << "\": " << opCount[op];
+        isFirst = false;
+    }
+    out << (isFirst ? "}\n" : "\n  }\n") << "}\n";
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    // Argument Variables
+    char *romDir = NULL;
+    char *outDir = NULL;
+    unsigned int threadCount = thread::hardware_concurrency();
+
+    // Check Arguments
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            cout << "Usage: yac8_corpus [romDir] [outDir] [OPTIONS]\n\n"
+                 << "INFO:\n"
+                 << "romDir \t\t\t Directory of ROMs to Analyze (Recursive)\n"
+                 << "outDir \t\t\t Directory to write a JSON Report per ROM into\n\n"
+
+                 << "OPTIONS:\n"
+                 << "-h, --help \t\t Outputs Help Manual\n"
+                 << "--threads [count] \t Number of Worker Threads\n";
+            exit(0);
+        } else if (arg == "--threads" && (i + 1) < argc) {
+            threadCount = stoi(argv[i + 1]);
+            i++;
+        } else if (romDir == NULL) {
+            romDir = argv[i];
+        } else if (outDir == NULL) {
+            outDir = argv[i];
+        }
+    }
+
+    if (romDir == NULL || outDir == NULL) {
+        cerr << "ROM Directory and Output Directory Required!\n";
+        exit(1);
+    }
+    if (threadCount == 0) threadCount = 1;
+
+    // Gather ROMs
+    error_code err;
+    vector<fs::path> roms;
+    for (const auto &entry : fs::recursive_directory_iterator(romDir, err))
+        if (entry.is_regular_file()) roms.push_back(entry.path());
+    if (err) {
+        cerr << "Failed to Read '" << romDir << "': " << err.message() << '\n';
+        exit(1);
+    }
+
+    fs::create_directories(outDir, err);
+    if (err) {
+        cerr << "Failed to Create '" << outDir << "': " << err.message() << '\n';
+        exit(1);
+    }
+
+    // Workers pull the Next ROM off a Shared Index
+    auto startTime = chrono::steady_clock::now();
+    atomic<size_t> nextROM(0);
+    atomic<size_t> failed(0);
+    vector<thread> workers;
+
+    for (unsigned int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&]() {
+            for (size_t i = nextROM++; i < roms.size(); i = nextROM++) {
+                // Flatten Sub-Directories into the Report Name
+                string name = fs::relative(roms[i], romDir).string();
+                for (char &c : name)
+                    if (c == '/' || c == '\\') c = '_';
+
+                ofstream report(fs::path(outDir) / (name + ".json"));
+                if (!report || !analyzeROM(roms[i], report))
+                    failed++;
+            }
+        });
+    }
+    for (thread &worker : workers)
+        worker.join();
+
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    cout << "Analyzed " << roms.size() - failed << '/' << roms.size() << " ROMs in "
+         << elapsed << "s using " << threadCount << " Threads\n";
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/CHIP-8.h"
+#include "../include/Disassembler.h"
+
+#define DIFF_FRAMES 3600  // Frames Run per Movie (Default)
+#define DIFF_IPF 20       // Instructions per Frame (Default)
+#define DIFF_MOVIES 8     // Randomized Input Movies per ROM (Default)
+#define DIFF_SEED 0xC8    // Seed of the First Movie (Default)
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/**
+ * Execution Engine being Compared against the Reference
+ *  - frame: Runs a Frame of N Instructions
+ *  - single: Runs exactly one Instruction
+ */
+struct Engine {
+    const char *name;
+    void (*frame)(CHIP8 &, u_int32_t);
+    void (*single)(CHIP8 &);
+};
+
+/**
+ * Reference Engine, CHIP8::run one Instruction at a Time
+ */
+static void referenceFrame(CHIP8 &cpu, u_int32_t ipf) {
+    for (u_int32_t i = 0; i < ipf; i++)
+        cpu.run(true);
+    cpu.drawFlag = false;
+}
+
+static void referenceSingle(CHIP8 &cpu) { cpu.run(true); }
+
+static void stepFrame(CHIP8 &cpu, u_int32_t ipf) { cpu.runFrame(ipf); }
+static void stepSingle(CHIP8 &cpu) { cpu.step(1); }
+
+static const Engine REFERENCE = {"run", referenceFrame, referenceSingle};
+static const Engine ENGINES[] = {
+    {"step", stepFrame, stepSingle},
+};
+
+/**
+ * Randomized Input Movie, Key Mask to hold for the Frame
+ *  Holds a Random Set of Keys for a Random 1-16 Frames,
+ *  same Sequence for the same Seed
+ */
+class Movie {
+  private:
+    uint64_t rng;
+    u_int32_t holdFrames;
+    u_int16_t keys;
+
+    uint64_t next() {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    }
+
+  public:
+    Movie(uint64_t seed) : rng(seed * 0x9E3779B97F4A7C15ULL + 1), holdFrames(0), keys(0) {}
+
+    u_int16_t nextFrame() {
+        if (holdFrames == 0) {
+            uint64_t r = next();
+            holdFrames = 1 + (r & 0xF);
+            // Mostly Nothing or a Single Key, Sometimes a Chord
+            switch ((r >> 4) & 0x3) {
+            case 0:  keys = 0x0; break;
+            case 3:  keys = u_int16_t(r >> 16); break;
+            default: keys = u_int16_t(1 << ((r >> 8) & 0xF)); break;
+            }
+        }
+        holdFrames--;
+        return keys;
+    }
+};
+
+/**
+ * Loads the ROM into a Fresh Core with the given RNG Seed
+ */
+static void boot(CHIP8 &cpu, const vector<u_char> &rom, uint64_t seed) {
+    cpu.loadROM(rom.data(), rom.size());
+    cpu.seed(seed);
+}
+
+static void setKeys(CHIP8 &cpu, u_int16_t keys) {
+    for (u_char i = 0x0; i <= 0xF; i++)
+        cpu.key[i] = (keys >> i) & 0x1;
+}
+
+/**
+ * Runs a Movie on an Engine, recording the State Hash after each Frame
+ *
+ * @param engine - Engine to Run
+ * @param cpu - Booted Core
+ * @param seed - Movie Seed
+ * @param frames - Frames to Run
+ * @param ipf - Instructions per Frame
+ * @param hashes - Filled with one Hash per Frame
+ */
+static void runMovie(const Engine &engine, CHIP8 &cpu, uint64_t seed, u_int32_t frames, u_int32_t ipf,
+                     vector<uint64_t> &hashes) {
+    Movie movie(seed);
+    hashes.resize(frames);
+    for (u_int32_t frame = 0; frame < frames; frame++) {
+        setKeys(cpu, movie.nextFrame());
+        engine.frame(cpu, ipf);
+        hashes[frame] = cpu.hashState();
+    }
+}
+
+/**
+ * Dumps Registers and Stack of both Cores side by side
+ */
+static void dumpCores(CHIP8 &reference, CHIP8 &alternate, const Engine &engine) {
+    cout << "---- " << REFERENCE.name << " ----\n";
+    reference.regDump(cout);
+    reference.stackDump(cout);
+    cout << "---- " << engine.name << " ----\n";
+    alternate.regDump(cout);
+    alternate.stackDump(cout);
+}
+
+/**
+ * Replays both Engines up to the Divergent Frame, then Single
+ *  Steps to find and Dump the first Divergent Instruction
+ */
+static void reportDivergence(const Engine &engine, const vector<u_char> &rom, uint64_t seed,
+                             u_int32_t badFrame, u_int32_t ipf) {
+    CHIP8 reference, alternate;
+    boot(reference, rom, seed);
+    boot(alternate, rom, seed);
+
+    // Both Agree up to the Divergent Frame
+    Movie movie(seed);
+    for (u_int32_t frame = 0; frame < badFrame; frame++) {
+        u_int16_t keys = movie.nextFrame();
+        setKeys(reference, keys);
+        setKeys(alternate, keys);
+        REFERENCE.frame(reference, ipf);
+        engine.frame(alternate, ipf);
+    }
+
+    u_int16_t keys = movie.nextFrame();
+    setKeys(reference, keys);
+    setKeys(alternate, keys);
+    for (u_int32_t i = 0; i < ipf; i++) {
+        u_int16_t pc = reference.getProgramCounter();
+
+        // Capture the Reference's Trace of the Instruction
+        stringstream trace;
+        reference.setOutputStream(&trace);
+        REFERENCE.single(reference);
+        reference.setOutputStream(nullptr);
+        engine.single(alternate);
+
+        if (reference.hashState() != alternate.hashState()) {
+            cout << "First Divergence: Frame " << badFrame << ", Instruction " << i
+                 << " of Frame, Keys 0x" << hex << keys << ", PC 0x" << pc << dec << '\n'
+                 << "  " << trace.str();
+            dumpCores(reference, alternate, engine);
+            return;
+        }
+    }
+
+    // Frame Differs only when Run as a whole (Engine Batches Instructions)
+    cout << "Frame " << badFrame << " Diverged but not when Single Stepped, State at End of Frame:\n";
+    dumpCores(reference, alternate, engine);
+}
+
+int main(int argc, char **argv) {
+    // Argument Variables
+    const char *romDir = "roms";
+    const char *engineName = "step";
+    u_int32_t frames = DIFF_FRAMES;
+    u_int32_t ipf = DIFF_IPF;
+    u_int32_t movies = DIFF_MOVIES;
+    uint64_t firstSeed = DIFF_SEED;
+
+    // Check Arguments
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            cout << "Usage: yac8_difftest {romDir} [OPTIONS]\n\n"
+                 << "INFO:\n"
+                 << "romDir \t\t\t Directory of ROMs to Run (Default 'roms')\n\n"
+
+                 << "OPTIONS:\n"
+                 << "-h, --help \t\t Outputs Help Manual\n"
+                 << "--engine [name] \t Engine Compared against 'run' (Default 'step')\n"
+                 << "--frames [count] \t Frames to Run per Movie\n"
+                 << "--ipf [count] \t\t Instructions per Frame\n"
+                 << "--movies [count] \t Randomized Input Movies per ROM\n"
+                 << "--seed [seed] \t\t Seed of the First Movie\n";
+            exit(0);
+        } else if (arg == "--engine" && (i + 1) < argc) {
+            engineName = argv[++i];
+        } else if (arg == "--frames" && (i + 1) < argc) {
+            frames = stoul(argv[++i]);
+        } else if (arg == "--ipf" && (i + 1) < argc) {
+            ipf = stoul(argv[++i]);
+        } else if (arg == "--movies" && (i + 1) < argc) {
+            movies = stoul(argv[++i]);
+        } else if (arg == "--seed" && (i + 1) < argc) {
+            firstSeed = stoull(argv[++i]);
+        } else {
+            romDir = argv[i];
+        }
+    }
+
+    if (frames == 0 || ipf == 0 || movies == 0) {
+        cerr << "Frames, IPF, and Movies must be greater than 0!\n";
+        exit(1);
+    }
+
+    const Engine *engine = NULL;
+    for (const Engine &e : ENGINES)
+        if (string(e.name) == engineName) engine = &e;
+    if (!engine) {
+        cerr << "Unknown Engine '" << engineName << "'\n";
+        exit(1);
+    }
+
+    // Gather ROMs (Sorted for Stable Output)
+    error_code err;
+    vector<fs::path> roms;
+    for (const auto &entry : fs::directory_iterator(romDir, err))
+        if (entry.is_regular_file()) roms.push_back(entry.path());
+    if (err) {
+        cerr << "Failed to Read '" << romDir << "': " << err.message() << '\n';
+        exit(1);
+    }
+    sort(roms.begin(), roms.end());
+
+    int divergences = 0;
+    u_int64_t instructions = 0;
+    auto startTime = chrono::steady_clock::now();
+
+    for (const fs::path &romPath : roms) {
+        Disassembler dasm;
+        vector<u_char> rom;
+        string pathStr = romPath.string();
+        if (!dasm.readROM(&pathStr[0], rom) || rom.size() > sizeof(CHIP8State::memory) - ROM_START) {
+            cerr << "Skipping '" << pathStr << "'\n";
+            continue;
+        }
+        ProgramMap map = dasm.analyze(rom.data(), u_int16_t(rom.size()));
+
+        bool isDiverged = false;
+        for (u_int32_t m = 0; m < movies && !isDiverged; m++) {
+            uint64_t seed = firstSeed + m;
+            vector<uint64_t> referenceHashes, alternateHashes;
+
+            // Each Engine on it's own Thread, Compared once both Finish
+            CHIP8 *reference = new CHIP8();
+            CHIP8 *alternate = new CHIP8();
+            boot(*reference, rom, seed);
+            boot(*alternate, rom, seed);
+            alternate->prewarm(map);
+
+            thread referenceThread(runMovie, cref(REFERENCE), ref(*reference), seed, frames, ipf,
+                                   ref(referenceHashes));
+            runMovie(*engine, *alternate, seed, frames, ipf, alternateHashes);
+            referenceThread.join();
+            delete reference;
+            delete alternate;
+            instructions += u_int64_t(frames) * ipf * 2;
+
+            // First Frame where the Hashes Differ
+            auto diff = mismatch(referenceHashes.begin(), referenceHashes.end(), alternateHashes.begin());
+            if (diff.first != referenceHashes.end()) {
+                u_int32_t badFrame = u_int32_t(diff.first - referenceHashes.begin());
+                cout << "DIVERGED " << romPath.filename().string() << " (Movie Seed " << seed << ")\n";
+                reportDivergence(*engine, rom, seed, badFrame, ipf);
+                isDiverged = true;  // One Report per ROM
+                divergences++;
+            }
+        }
+        if (!isDiverged)
+            cout << "OK " << romPath.filename().string() << '\n';
+    }
+
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    printf("%d Divergence(s), %llu Instructions in %.2fs (%.1fM Instructions/s)\n", divergences,
+           (unsigned long long)instructions, elapsed, instructions / elapsed / 1e6);
+    return divergences ? 1 : 0;
+}
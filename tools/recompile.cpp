@@ -0,0 +1,251 @@
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/CHIP-8.h"
+#include "../include/Disassembler.h"
+#include "../include/Hash.h"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/**
+ * Formats a Value as 0x Prefixed Uppercase Hex
+ */
+static string hexStr(unsigned long long val) {
+    stringstream ss;
+    ss << "0x" << hex << uppercase << val;
+    return ss.str();
+}
+
+/**
+ * Turns a File Name into the Suffix of a C Identifier
+ *
+ * @param name - ROM's File Name
+ */
+static string identifier(const string &name) {
+    string res;
+    for (char c : name)
+        res += isalnum(u_char(c)) ? c : '_';
+    return res;
+}
+
+/**
+ * ROM Word at the Address, 0 past the End of the ROM
+ */
+static u_int16_t wordAt(const vector<u_char> &rom, u_int16_t addr) {
+    size_t offset = addr - ROM_START;
+    return offset + 1 < rom.size() ? (rom[offset] << 8) | rom[offset + 1] : 0x0;
+}
+
+/**
+ * Memory Pages a Block's Bytes live in
+ */
+static uint64_t pageMask(const BasicBlock &block) {
+    uint64_t mask = 0x0;
+    for (u_int16_t addr = block.start; addr < block.end && addr < MEMORY_SIZE; addr++)
+        mask |= 1ULL << (addr / DIRTY_PAGE_SIZE);
+    return mask;
+}
+
+/**
+ * Outputs the C++ for a Single Instruction
+ *  Mirrors the CHIP8 Handlers Statement for Statement, so
+ *  Flags come out the same even when X or Y is VF
+ *
+ * @param out - Output Stream
+ * @param opcode - 2 Byte Opcode
+ * @param addr - Address of the Instruction
+ * @param remaining - Instructions left in the Block after this one
+ * @param pages - Block's Page Mask
+ * @returns True if the Instruction always Leaves the Block
+ */
+static bool emitInstruction(ostream &out, u_int16_t opcode, u_int16_t addr, int remaining, uint64_t pages) {
+    Instruction ins = CHIP8::decode(opcode, MODE_CHIP8);
+    string vx = "s.V[" + hexStr(ins.x) + "]";
+    string vy = "s.V[" + hexStr(ins.y) + "]";
+    string kk = hexStr((ins.y << 4) | ins.n);
+    string nnn = hexStr(opcode & 0xFFF);
+    string next = hexStr(addr + 0x2);
+    string skip = hexStr(addr + 0x4);  // Translations only Run in CHIP-8 Mode, where every Instruction is 2 Bytes
+
+    out << "            // [" << hex << uppercase << addr << "] " << setw(4) << setfill('0') << opcode
+        << dec << ' ' << operationNames[ins.op] << '\n'
+        << "            ";
+
+    // Ends the Block Early, Handing back Instructions not Run
+    string leave = remaining ? "n -= " + to_string(remaining) + "; continue;" : "continue;";
+
+    switch (ins.op) {
+    case OP_CLS:        out << "cpu.CLS();"; break;
+    case OP_RET:        out << "s.PC = " << hexStr(addr) << "; cpu.RET(); s.PC += 0x2; TICK(); if (s.fault) return n; " << leave << '\n'; return true;
+    case OP_JP:         out << "s.PC = " << nnn << "; TICK(); " << leave << '\n'; return true;
+    case OP_CALL:       out << "s.PC = " << hexStr(addr) << "; cpu.CALL(" << nnn << "); s.PC += 0x2; TICK(); if (s.fault) return n; " << leave << '\n'; return true;
+    case OP_SE_BYTE:    out << "s.PC = " << vx << " == " << kk << " ? " << skip << " : " << next << "; TICK(); " << leave << '\n'; return true;
+    case OP_SNE_BYTE:   out << "s.PC = " << vx << " != " << kk << " ? " << skip << " : " << next << "; TICK(); " << leave << '\n'; return true;
+    case OP_SE_REG:     out << "s.PC = " << vx << " == " << vy << " ? " << skip << " : " << next << "; TICK(); " << leave << '\n'; return true;
+    case OP_SNE_REG:    out << "s.PC = " << vx << " != " << vy << " ? " << skip << " : " << next << "; TICK(); " << leave << '\n'; return true;
+    case OP_JP_V0:      out << "s.PC = " << nnn << " + s.V[0x0]; TICK(); " << leave << '\n'; return true;
+    case OP_SKP:        out << "s.PC = " << hexStr(addr) << "; cpu.SKP(" << vx << "); s.PC += 0x2; TICK(); " << leave << '\n'; return true;
+    case OP_SKNP:       out << "s.PC = " << hexStr(addr) << "; cpu.SKNP(" << vx << "); s.PC += 0x2; TICK(); " << leave << '\n'; return true;
+    case OP_LD_VX_K:    out << "s.PC = " << hexStr(addr) << "; cpu.SKP(" << vx << "); TICK(); " << leave << '\n'; return true;
+    case OP_LD_BYTE:    out << vx << " = " << kk << ";"; break;
+    case OP_ADD_BYTE:   out << vx << " = (" << vx << " + " << kk << ") & 0xFF;"; break;
+    case OP_LD_REG:     out << vx << " = " << vy << ";"; break;
+    case OP_OR:         out << vx << " |= " << vy << ";"; break;
+    case OP_AND:        out << vx << " &= " << vy << ";"; break;
+    case OP_XOR:        out << vx << " ^= " << vy << ";"; break;
+    case OP_ADD_REG:    out << "{ u_char b = " << vy << "; s.V[0xF] = " << vx << " + b > 0xFF; " << vx << " = (" << vx << " + b) & 0xFF; }"; break;
+    case OP_SUB:        out << "{ u_char b = " << vy << "; s.V[0xF] = " << vx << " > b; " << vx << " -= b; }"; break;
+    case OP_SHR:        out << "s.V[0xF] = " << vx << " & 0x1; " << vx << " >>= 1;"; break;
+    case OP_SUBN:       out << "{ u_char b = " << vy << "; s.V[0xF] = b > " << vx << "; " << vx << " = b - " << vx << "; }"; break;
+    case OP_SHL:        out << "s.V[0xF] = (" << vx << " & 0x80) ? 0x1 : 0x0; " << vx << " <<= 1;"; break;
+    case OP_LD_I:       out << "s.I = " << nnn << ";"; break;
+    case OP_RND:        out << "cpu.RND(&" << vx << ", " << kk << ");"; break;
+    case OP_DRW:        out << "cpu.DRW(&" << vx << ", &" << vy << ", " << hexStr(ins.n) << ");"; break;
+    case OP_LD_VX_DT:   out << vx << " = s.dTimer;"; break;
+    case OP_LD_DT:      out << "s.dTimer = " << vx << ";"; break;
+    case OP_LD_ST:      out << "s.sTimer = " << vx << "; if (s.sTimer) cpu.soundFlag = true;"; break;
+    case OP_ADD_I:      out << "s.I += " << vx << ";"; break;
+    case OP_LD_F:       out << "s.I = u_int16_t(" << vx << " * 0x5);"; break;
+    case OP_LD_VX_MEM:  out << "cpu.LD(u_char(" << hexStr(ins.x) << "), &s.I);"; break;
+    case OP_SCD:        out << "cpu.SCD(" << hexStr(ins.n) << ");"; break;
+    case OP_SCR:        out << "cpu.SCR();"; break;
+    case OP_SCL:        out << "cpu.SCL();"; break;
+    case OP_EXIT:       out << "s.PC = " << hexStr(addr) << "; cpu.EXIT(); s.PC += 0x2; TICK(); return n;\n"; return true;
+    case OP_LOW:        out << "cpu.LOW();"; break;
+    case OP_HIGH:       out << "cpu.HIGH();"; break;
+    case OP_LD_HF:      out << "s.I = u_int16_t(BIG_FONT_START + (" << vx << " & 0xF) * 10);"; break;
+    case OP_LD_R_VX:    out << "cpu.STR(" << hexStr(ins.x) << ");"; break;
+    case OP_LD_VX_R:    out << "cpu.LDR(" << hexStr(ins.x) << ");"; break;
+    case OP_SCU:        out << "cpu.SCU(" << hexStr(ins.n) << ");"; break;
+
+    // Memory Writes, Leave if they Dirtied this Block's own Code
+    case OP_LD_B:
+    case OP_LD_MEM_VX:
+        if (ins.op == OP_LD_B) out << "cpu.LD(" << vx << ");";
+        else                   out << "cpu.LD(&s.I, u_char(" << hexStr(ins.x) << "));";
+        out << " TICK();\n"
+            << "            if (*dirtyPages & " << hexStr(pages) << "ULL) { s.PC = " << next << "; " << leave << " }\n";
+        return false;
+
+    default:            break;
+    }
+    out << " TICK();\n";
+    return false;
+}
+
+/**
+ * Translates the ROM into a C++ Translation Unit
+ *  One switch case per Basic Block, Dispatched on the PC
+ *  so Indirect Jumps land on any Translated Block
+ *
+ * @param out - Output Stream for the Source
+ * @param rom - ROM's Bytes
+ * @param map - Control Flow Analysis of the ROM
+ * @param name - Name the Translation is Exported under (yac8_aot_[name])
+ * @param romName - ROM's File Name
+ */
+static void translate(ostream &out, const vector<u_char> &rom, const ProgramMap &map,
+                      const string &name, const string &romName) {
+    out << "// Translated from '" << romName << "' by yac8_recompile, Do not Edit\n"
+        << "#include \"CHIP-8.h\"\n\n"
+        << "#define TICK() (s.dTimer -= s.dTimer > 0, s.sTimer -= s.sTimer > 0)  // Timers Decrement per Instruction\n\n"
+        << "static u_int32_t run(CHIP8 &cpu, CHIP8State &s, u_int32_t count, const uint64_t *dirtyPages) {\n"
+        << "    u_int32_t n = 0;\n"
+        << "    for (;;) {\n"
+        << "        switch (s.PC) {\n";
+
+    for (const auto &entry : map.blocks) {
+        const BasicBlock &block = entry.second;
+        uint64_t pages = pageMask(block);
+        int length = 0;
+        for (u_int16_t addr = block.start; addr < block.end; addr += 0x2)
+            length++;
+
+        out << "        case " << hexStr(block.start) << ":  // " << block.label << '\n'
+            << "            if (count - n < " << length << " || (*dirtyPages & " << hexStr(pages) << "ULL)) return n;\n"
+            << "            n += " << length << ";\n";
+
+        int remaining = length;
+        bool isExit = false;
+        for (u_int16_t addr = block.start; addr < block.end; addr += 0x2)
+            isExit = emitInstruction(out, wordAt(rom, addr), addr, --remaining, pages);
+
+        // Falls into the Next Block
+        if (!isExit)
+            out << "            s.PC = " << hexStr(block.end) << ";\n"
+                << "            continue;\n";
+    }
+
+    out << "        default:  // Untranslated, Interpreter takes over\n"
+        << "            return n;\n"
+        << "        }\n"
+        << "    }\n"
+        << "}\n\n"
+        << "extern const CompiledROM yac8_aot_" << name << ";\n"
+        << "const CompiledROM yac8_aot_" << name << " = {" << hexStr(Hash::hash64(rom.data(), rom.size()))
+        << "ULL, " << hexStr(rom.size()) << ", run};\n";
+}
+
+int main(int argc, char **argv) {
+    // Argument Variables
+    char *romPath = NULL;
+    char *srcOutput = NULL;
+    string name;
+
+    // Check Arguments
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            cout << "Usage: yac8_recompile [romPath] [outFile] [OPTIONS]\n\n"
+                 << "INFO:\n"
+                 << "romPath \t\t ROM to Translate\n"
+                 << "outFile \t\t C++ Source File to Write\n\n"
+
+                 << "OPTIONS:\n"
+                 << "-h, --help \t\t Outputs Help Manual\n"
+                 << "--name [name] \t\t Exports the Translation as yac8_aot_[name] (Default ROM File Name)\n";
+            exit(0);
+        } else if (arg == "--name" && (i + 1) < argc) {
+            name = argv[++i];
+        } else if (romPath == NULL) {
+            romPath = argv[i];
+        } else if (srcOutput == NULL) {
+            srcOutput = argv[i];
+        }
+    }
+
+    if (romPath == NULL || srcOutput == NULL) {
+        cerr << "ROM Path and Output File Required!\n";
+        exit(1);
+    }
+
+    Disassembler dasm;
+    vector<u_char> rom;
+    if (!dasm.readROM(romPath, rom) || rom.size() > 0x1000 - ROM_START) {
+        cerr << "Failed to Read ROM '" << romPath << "'\n";
+        exit(1);
+    }
+    ProgramMap map = dasm.analyze(rom.data(), u_int16_t(rom.size()));
+
+    string romName = fs::path(romPath).filename().string();
+    if (name.empty()) name = romName;
+
+    ofstream file(srcOutput);
+    translate(file, rom, map, identifier(name), romName);
+    if (!file) {
+        cerr << "Failed to Write '" << srcOutput << "'\n";
+        exit(1);
+    }
+
+    cout << "Translated " << map.blocks.size() << " Blocks to '" << srcOutput << "' as yac8_aot_"
+         << identifier(name) << '\n';
+    return 0;
+}